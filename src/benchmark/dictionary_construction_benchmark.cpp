@@ -0,0 +1,75 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include <boost/hana/for_each.hpp>
+
+#include "all_type_variant.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/value_segment.hpp"
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+namespace {
+
+constexpr auto ROW_COUNT = ChunkOffset{65'535};
+constexpr auto REPETITIONS = 20;
+
+template <typename T>
+T make_value(const uint32_t number) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Mimics typical identifiers, which are too long for the small string optimization.
+    return "customer#" + std::to_string(1'000'000'000 + number) + "_de";
+  } else {
+    return static_cast<T>(number) * T{3};
+  }
+}
+
+template <typename T>
+std::shared_ptr<ValueSegment<T>> make_value_segment(const uint32_t distinct_count) {
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<uint32_t>{0, distinct_count - 1};
+  const auto value_segment = std::make_shared<ValueSegment<T>>(true);
+  for (auto row = ChunkOffset{0}; row < ROW_COUNT; ++row) {
+    if (row % 100 == 0) {
+      value_segment->append(NULL_VALUE);
+    } else {
+      value_segment->append(make_value<T>(distribution(generator)));
+    }
+  }
+  return value_segment;
+}
+
+}  // namespace
+
+// Measures the throughput of DictionarySegment construction for all data types and different cardinalities. Each
+// segment holds a full chunk of 65,535 rows, 1% of them NULL.
+int main() {
+  std::cout << std::left << std::setw(10) << "type" << std::setw(12) << "distinct" << std::setw(16) << "ms/segment"
+            << "rows/s" << std::endl;
+
+  hana::for_each(data_types, [](const auto type_pair) {
+    using ColumnDataType = typename decltype(+hana::second(type_pair))::type;
+    const auto type_name = std::string{hana::first(type_pair)};
+
+    for (const auto distinct_count : {uint32_t{16}, uint32_t{1'024}, uint32_t{ROW_COUNT}}) {
+      const auto value_segment = make_value_segment<ColumnDataType>(distinct_count);
+
+      auto unique_values_count = size_t{0};
+      const auto start = std::chrono::steady_clock::now();
+      for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+        const auto dictionary_segment = DictionarySegment<ColumnDataType>{value_segment};
+        unique_values_count += dictionary_segment.unique_values_count();
+      }
+      const auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      // Printing the number of distinct values also prevents the compiler from optimizing the construction away.
+      std::cout << std::setw(10) << type_name << std::setw(12) << unique_values_count / REPETITIONS << std::setw(16)
+                << std::fixed << std::setprecision(3) << duration * 1000 / REPETITIONS << std::setprecision(0)
+                << ROW_COUNT * REPETITIONS / duration << std::endl;
+    }
+  });
+
+  return 0;
+}
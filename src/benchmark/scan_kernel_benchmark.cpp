@@ -0,0 +1,173 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include <boost/hana/for_each.hpp>
+
+#include "all_type_variant.hpp"
+#include "operators/scan_kernels.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/external_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+namespace {
+
+constexpr auto ROW_COUNT = ChunkOffset{65'535};
+constexpr auto REPETITIONS = 10;
+constexpr auto DISTINCT_COUNT = uint32_t{1'000};
+
+const auto SCAN_TYPES = std::vector<std::pair<ScanType, std::string>>{
+    {ScanType::OpEquals, "="},      {ScanType::OpNotEquals, "!="},         {ScanType::OpLessThan, "<"},
+    {ScanType::OpLessThanEquals, "<="}, {ScanType::OpGreaterThan, ">"}, {ScanType::OpGreaterThanEquals, ">="}};
+
+template <typename T>
+T make_value(const uint32_t number) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return "customer#" + std::to_string(1'000'000'000 + number) + "_de";
+  } else {
+    return static_cast<T>(number) * T{3};
+  }
+}
+
+// Creates a full chunk of values in runs of four rows, so that run-length encoding has something to compress. If the
+// segment is nullable, 1% of the rows are NULL.
+template <typename T>
+std::shared_ptr<ValueSegment<T>> make_value_segment(const bool nullable) {
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<uint32_t>{0, DISTINCT_COUNT - 1};
+  auto values = std::vector<T>(ROW_COUNT);
+  auto null_values = NullBitmap{ROW_COUNT};
+  for (auto row = ChunkOffset{0}; row < ROW_COUNT; row += 4) {
+    const auto value = make_value<T>(distribution(generator));
+    std::fill(values.begin() + row, values.begin() + std::min(row + 4, static_cast<uint32_t>(ROW_COUNT)), value);
+  }
+  if (!nullable) {
+    return std::make_shared<ValueSegment<T>>(std::move(values));
+  }
+  for (auto row = ChunkOffset{0}; row < ROW_COUNT; row += 100) {
+    null_values.set(row, true);
+  }
+  return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+}
+
+// The generic path, which reads every row through the virtual AbstractSegment::operator[] and switches on the data
+// type of the AllTypeVariant and on the ScanType for every row.
+template <typename T>
+void generic_scan(const AbstractSegment& segment, const ScanType scan_type, const T& search_value,
+                  PosList& matches) {
+  const auto segment_size = segment.size();
+  for (auto offset = ChunkOffset{0}; offset < segment_size; ++offset) {
+    const auto variant = segment[offset];
+    if (variant_is_null(variant)) {
+      continue;
+    }
+    const auto& value = boost::get<T>(variant);
+    auto is_match = false;
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        is_match = value == search_value;
+        break;
+      case ScanType::OpNotEquals:
+        is_match = value != search_value;
+        break;
+      case ScanType::OpLessThan:
+        is_match = value < search_value;
+        break;
+      case ScanType::OpLessThanEquals:
+        is_match = value <= search_value;
+        break;
+      case ScanType::OpGreaterThan:
+        is_match = value > search_value;
+        break;
+      case ScanType::OpGreaterThanEquals:
+        is_match = value >= search_value;
+        break;
+    }
+    if (is_match) {
+      matches.emplace_back(RowID{ChunkID{0}, offset});
+    }
+  }
+}
+
+// Runs a scan REPETITIONS times and returns the milliseconds per scan. The number of matches is checked by the caller,
+// which also keeps the compiler from optimizing the scans away.
+template <typename Scan>
+double measure(const Scan& scan, size_t& match_count) {
+  auto matches = PosList{};
+  matches.reserve(ROW_COUNT);
+  const auto start = std::chrono::steady_clock::now();
+  for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+    matches.clear();
+    scan(matches);
+  }
+  const auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  match_count = matches.size();
+  return duration * 1000 / REPETITIONS;
+}
+
+}  // namespace
+
+// Compares every scan kernel to the generic scan on a full chunk of 65,535 rows with 1,000 distinct values. Nullable
+// segments have 1% NULL values. The search value lies in the middle of the value range.
+int main() {
+  std::cout << std::left << std::setw(8) << "type" << std::setw(20) << "encoding" << std::setw(6) << "scan"
+            << std::setw(10) << "nullable" << std::setw(12) << "matches" << std::setw(14) << "kernel ms"
+            << std::setw(14) << "generic ms" << "speedup" << std::endl;
+
+  hana::for_each(data_types, [](const auto type_pair) {
+    using ColumnDataType = typename decltype(+hana::second(type_pair))::type;
+    const auto type_name = std::string{hana::first(type_pair)};
+    const auto search_value = make_value<ColumnDataType>(DISTINCT_COUNT / 2);
+
+    for (const auto nullable : {false, true}) {
+      const auto value_segment = make_value_segment<ColumnDataType>(nullable);
+      auto segments = std::vector<std::pair<std::string, std::shared_ptr<AbstractSegment>>>{
+          {"unencoded", value_segment},
+          {"dictionary", std::make_shared<DictionarySegment<ColumnDataType>>(value_segment)},
+          {"dictionary packed",
+           std::make_shared<DictionarySegment<ColumnDataType>>(value_segment, VectorCompressionType::BitPacked)},
+          {"run length", std::make_shared<RunLengthSegment<ColumnDataType>>(value_segment)}};
+      if constexpr (std::is_same_v<ColumnDataType, int32_t> || std::is_same_v<ColumnDataType, int64_t>) {
+        segments.emplace_back("frame of reference",
+                              std::make_shared<FrameOfReferenceSegment<ColumnDataType>>(value_segment));
+      }
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        const auto null_values =
+            nullable ? std::optional<NullBitmap>{value_segment->null_values()} : std::optional<NullBitmap>{};
+        segments.emplace_back("external", std::make_shared<ExternalSegment<ColumnDataType>>(
+                                              std::span<const ColumnDataType>{value_segment->values()},
+                                              value_segment, std::optional<NullBitmap>{null_values}));
+      }
+
+      for (const auto& [encoding_name, segment] : segments) {
+        for (const auto& [scan_type, scan_name] : SCAN_TYPES) {
+          auto kernel_match_count = size_t{0};
+          const auto kernel_ms = measure(
+              [&](PosList& matches) {
+                const auto kernel = ScanKernels<ColumnDataType>::select(*segment, scan_type, nullable);
+                kernel(*segment, search_value, ChunkID{0}, matches);
+              },
+              kernel_match_count);
+          auto generic_match_count = size_t{0};
+          const auto generic_ms = measure(
+              [&](PosList& matches) { generic_scan(*segment, scan_type, search_value, matches); },
+              generic_match_count);
+          Assert(kernel_match_count == generic_match_count, "Kernel and generic scan disagree.");
+
+          std::cout << std::setw(8) << type_name << std::setw(20) << encoding_name << std::setw(6) << scan_name
+                    << std::setw(10) << nullable << std::setw(12) << kernel_match_count << std::setw(14) << std::fixed
+                    << std::setprecision(3) << kernel_ms << std::setw(14) << generic_ms << std::setprecision(1)
+                    << generic_ms / kernel_ms << "x" << std::endl;
+        }
+      }
+    }
+  });
+
+  return 0;
+}
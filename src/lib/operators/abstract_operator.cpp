@@ -16,6 +16,14 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+std::shared_ptr<const AbstractOperator> AbstractOperator::left_input() const {
+  return _left_input;
+}
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::right_input() const {
+  return _right_input;
+}
+
 std::shared_ptr<const Table> AbstractOperator::_left_input_table() const {
   return _left_input->get_output();
 }
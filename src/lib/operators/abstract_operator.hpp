@@ -12,8 +12,9 @@ class Table;
 // output table. Their lifecycle has three phases:
 // 1. The operator is constructed. Previous operators are not guaranteed to have already executed, so operators must not
 // call get_output in their execute method
-// 2. The execute method is called from the outside (usually by the scheduler). This is where the heavy lifting is done.
-// By now, the input operators have already executed.
+// 2. The execute method is called from the outside (usually by the scheduler, see OperatorTask). This is where the
+// heavy lifting is done. By now, the input operators have already executed. Operators may split their work into
+// sub-tasks (e.g., JobTasks per chunk) that run on the same WorkerPool.
 // 3. The consumer (usually another operator) calls get_output. This should be very cheap. It is only guaranteed to
 // succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
 //
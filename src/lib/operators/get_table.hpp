@@ -1,27 +1,22 @@
 #pragma once
 
+#include <string>
+
 #include "abstract_operator.hpp"
-#include "utils/assert.hpp"
 
 namespace opossum {
 
 // Operator to retrieve a table from the StorageManager by specifying its name.
 class GetTable : public AbstractOperator {
  public:
-  explicit GetTable(const std::string& name) {
-    // TODO(student) implement it in a source file and change this to a declaration.
-  }
+  explicit GetTable(const std::string& name);
 
-  const std::string& table_name() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  const std::string& table_name() const;
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _table_name;
 };
 
 }  // namespace opossum
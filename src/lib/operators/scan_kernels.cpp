@@ -0,0 +1,378 @@
+#include "scan_kernels.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <tuple>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/comparator.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Number of value ids that are decoded at once when scanning a DictionarySegment.
+constexpr auto DECODE_BLOCK_SIZE = size_t{2048};
+
+constexpr auto SCAN_TYPE_COUNT = size_t{6};
+constexpr auto ENCODING_COUNT = size_t{5};
+
+// Kernels are stored ordered by ScanType, then ScanEncoding, then nullability.
+constexpr auto KERNEL_COUNT = SCAN_TYPE_COUNT * ENCODING_COUNT * 2;
+
+constexpr size_t kernel_index(const ScanType scan_type, const ScanEncoding encoding, const bool nullable) {
+  return (static_cast<size_t>(scan_type) * ENCODING_COUNT + static_cast<size_t>(encoding)) * 2 + size_t{nullable};
+}
+
+// The segment class of each ScanEncoding, in the order of the enum.
+template <typename T, ScanEncoding encoding>
+using EncodedSegment = std::tuple_element_t<static_cast<size_t>(encoding),
+                                            std::tuple<ValueSegment<T>, DictionarySegment<T>, RunLengthSegment<T>,
+                                                       FrameOfReferenceSegment<T>, ExternalSegment<T>>>;
+
+template <typename T, ScanEncoding encoding>
+constexpr bool is_supported_encoding() {
+  if constexpr (encoding == ScanEncoding::FrameOfReference) {
+    return std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+  } else if constexpr (encoding == ScanEncoding::External) {
+    return std::is_arithmetic_v<T>;
+  } else {
+    return true;
+  }
+}
+
+// Compares the rows 64 at a time into a match mask without branches. This way, the NULL values of nullable segments
+// are removed with a single AND per word of the null bitmap.
+template <bool nullable, typename Values, typename Comparator, typename SearchValue>
+void scan_values(const Values& values, const ChunkOffset segment_size, const uint64_t* null_words,
+                 const Comparator comparator, const SearchValue& search_value, const ChunkID chunk_id,
+                 PosList& matches) {
+  for (auto word_begin = ChunkOffset{0}; word_begin < segment_size; word_begin += NullBitmap::BITS_PER_WORD) {
+    const auto word_end = std::min(static_cast<ChunkOffset>(word_begin + NullBitmap::BITS_PER_WORD), segment_size);
+    auto mask = uint64_t{0};
+    for (auto offset = word_begin; offset < word_end; ++offset) {
+      mask |= static_cast<uint64_t>(comparator(values[offset], search_value)) << (offset - word_begin);
+    }
+    if constexpr (nullable) {
+      mask &= ~null_words[word_begin / NullBitmap::BITS_PER_WORD];
+    }
+    for (; mask != 0; mask &= mask - 1) {
+      matches.emplace_back(RowID{chunk_id, word_begin + static_cast<ChunkOffset>(std::countr_zero(mask))});
+    }
+  }
+}
+
+// Integer type of the value ids in an attribute vector. Decoded value ids are ValueIDs, which wrap a uint32_t.
+template <typename Code>
+using CodeInteger = std::conditional_t<std::is_same_v<Code, ValueID>, uint32_t, Code>;
+
+#if defined(__AVX2__)
+// AVX2 operations on 32 bytes of value ids of one width.
+template <typename Integer>
+struct SimdCodeOperations;
+
+template <>
+struct SimdCodeOperations<uint8_t> {
+  static __m256i set1(const uint8_t value) {
+    return _mm256_set1_epi8(static_cast<char>(value));
+  }
+  static __m256i sub(const __m256i lhs, const __m256i rhs) {
+    return _mm256_sub_epi8(lhs, rhs);
+  }
+  static __m256i min(const __m256i lhs, const __m256i rhs) {
+    return _mm256_min_epu8(lhs, rhs);
+  }
+  static __m256i cmpeq(const __m256i lhs, const __m256i rhs) {
+    return _mm256_cmpeq_epi8(lhs, rhs);
+  }
+};
+
+template <>
+struct SimdCodeOperations<uint16_t> {
+  static __m256i set1(const uint16_t value) {
+    return _mm256_set1_epi16(static_cast<int16_t>(value));
+  }
+  static __m256i sub(const __m256i lhs, const __m256i rhs) {
+    return _mm256_sub_epi16(lhs, rhs);
+  }
+  static __m256i min(const __m256i lhs, const __m256i rhs) {
+    return _mm256_min_epu16(lhs, rhs);
+  }
+  static __m256i cmpeq(const __m256i lhs, const __m256i rhs) {
+    return _mm256_cmpeq_epi16(lhs, rhs);
+  }
+};
+
+template <>
+struct SimdCodeOperations<uint32_t> {
+  static __m256i set1(const uint32_t value) {
+    return _mm256_set1_epi32(static_cast<int32_t>(value));
+  }
+  static __m256i sub(const __m256i lhs, const __m256i rhs) {
+    return _mm256_sub_epi32(lhs, rhs);
+  }
+  static __m256i min(const __m256i lhs, const __m256i rhs) {
+    return _mm256_min_epu32(lhs, rhs);
+  }
+  static __m256i cmpeq(const __m256i lhs, const __m256i rhs) {
+    return _mm256_cmpeq_epi32(lhs, rhs);
+  }
+};
+
+// Applies a lane-wise comparison to 64 value ids and collects one bit per value id, in order.
+template <typename Code, typename Compare>
+uint64_t movemask_64(const Code* codes, const Compare& compare) {
+  const auto load = [&](const size_t index) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + index));
+  };
+  auto mask = uint64_t{0};
+  if constexpr (sizeof(Code) == 1) {
+    for (auto index = size_t{0}; index < 64; index += 32) {
+      mask |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(compare(load(index))))} << index;
+    }
+  } else if constexpr (sizeof(Code) == 2) {
+    for (auto index = size_t{0}; index < 64; index += 32) {
+      // Packing interleaves the 128 bit lanes of both vectors, which the permutation undoes.
+      const auto packed = _mm256_packs_epi16(compare(load(index)), compare(load(index + 16)));
+      const auto ordered = _mm256_permute4x64_epi64(packed, 0b11011000);
+      mask |= uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(ordered))} << index;
+    }
+  } else {
+    for (auto index = size_t{0}; index < 64; index += 8) {
+      mask |= uint64_t{static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(compare(load(index)))))} << index;
+    }
+  }
+  return mask;
+}
+#endif
+
+// Appends the offsets of all value ids in codes that lie in [range_begin, range_begin + range_size) or, if inverted,
+// that lie outside of it and are not the NULL value id. range_size needs to be at least one. Value ids are compared 64
+// at a time into a match mask, using AVX2 compares and movemasks if available. first_offset is the chunk offset of
+// codes[0].
+template <bool inverted, typename Code>
+void scan_value_id_range(const Code* codes, const size_t size, const CodeInteger<Code> range_begin,
+                         const CodeInteger<Code> range_size, const CodeInteger<Code> null_code,
+                         const ChunkOffset first_offset, const ChunkID chunk_id, PosList& matches) {
+  using Integer = CodeInteger<Code>;
+  // Subtracting range_begin moves the range to [0, range_size), so a single unsigned comparison checks both bounds.
+  const auto matches_code = [&](const Integer code) {
+    const auto in_range = static_cast<Integer>(code - range_begin) < range_size;
+    if constexpr (inverted) {
+      return !in_range && code != null_code;
+    } else {
+      return in_range;
+    }
+  };
+
+  const auto emit = [&](const size_t word_begin, uint64_t mask) {
+    for (; mask != 0; mask &= mask - 1) {
+      const auto offset = first_offset + word_begin + static_cast<size_t>(std::countr_zero(mask));
+      matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(offset)});
+    }
+  };
+
+  auto word_begin = size_t{0};
+#if defined(__AVX2__)
+  using Operations = SimdCodeOperations<Integer>;
+  const auto begin_vector = Operations::set1(range_begin);
+  const auto last_vector = Operations::set1(static_cast<Integer>(range_size - 1));
+  const auto null_vector = Operations::set1(null_code);
+  const auto in_range = [&](const __m256i vector) {
+    const auto shifted = Operations::sub(vector, begin_vector);
+    return Operations::cmpeq(Operations::min(shifted, last_vector), shifted);
+  };
+  const auto is_null = [&](const __m256i vector) { return Operations::cmpeq(vector, null_vector); };
+  for (; word_begin + 64 <= size; word_begin += 64) {
+    auto mask = movemask_64(codes + word_begin, in_range);
+    if constexpr (inverted) {
+      mask = ~mask & ~movemask_64(codes + word_begin, is_null);
+    }
+    emit(word_begin, mask);
+  }
+#endif
+
+  for (; word_begin < size; word_begin += 64) {
+    const auto word_end = std::min(word_begin + 64, size);
+    auto mask = uint64_t{0};
+    for (auto index = word_begin; index < word_end; ++index) {
+      mask |= static_cast<uint64_t>(matches_code(static_cast<Integer>(codes[index]))) << (index - word_begin);
+    }
+    emit(word_begin, mask);
+  }
+}
+
+template <bool inverted>
+void scan_attribute_vector(const AbstractAttributeVector& attribute_vector, const ValueID range_begin,
+                           const ValueID range_end, const ValueID null_value_id, const ChunkID chunk_id,
+                           PosList& matches) {
+  const auto size = attribute_vector.size();
+  resolve_attribute_vector_type(attribute_vector, [&](const auto& typed_vector) {
+    if constexpr (std::is_same_v<std::decay_t<decltype(typed_vector)>, BitPackedVector>) {
+      // Bit-packed value ids are decoded block by block first.
+      auto value_ids = std::vector<ValueID>{};
+      for (auto block_begin = size_t{0}; block_begin < size; block_begin += DECODE_BLOCK_SIZE) {
+        const auto block_end = std::min(block_begin + DECODE_BLOCK_SIZE, size);
+        typed_vector.decode_range(block_begin, block_end, value_ids);
+        scan_value_id_range<inverted>(value_ids.data(), value_ids.size(), static_cast<uint32_t>(range_begin),
+                                      static_cast<uint32_t>(range_end - range_begin),
+                                      static_cast<uint32_t>(null_value_id), static_cast<ChunkOffset>(block_begin),
+                                      chunk_id, matches);
+      }
+    } else {
+      // Byte-aligned value ids are compared in place, in their own width.
+      using Integer = typename std::decay_t<decltype(typed_vector.values())>::value_type;
+      scan_value_id_range<inverted>(typed_vector.values().data(), size, static_cast<Integer>(range_begin),
+                                    static_cast<Integer>(range_end - range_begin),
+                                    static_cast<Integer>(null_value_id), ChunkOffset{0}, chunk_id, matches);
+    }
+  });
+}
+
+template <ScanType scan_type, bool nullable, typename T>
+void scan_dictionary_segment(const DictionarySegment<T>& segment, const T& search_value, const ChunkID chunk_id,
+                             PosList& matches) {
+  // As the dictionary is sorted, every predicate selects a contiguous range [begin, end) of value ids (or, for
+  // OpNotEquals, everything but that range). Thus, the search value is translated once, and we only compare value ids
+  // and never look at the values.
+  const auto unique_values_count = ValueID{segment.unique_values_count()};
+  const auto to_index = [&](const ValueID value_id) {
+    return value_id == INVALID_VALUE_ID ? unique_values_count : value_id;
+  };
+  const auto lower_bound = to_index(segment.lower_bound(search_value));
+  const auto upper_bound = to_index(segment.upper_bound(search_value));
+
+  auto begin = ValueID{0};
+  auto end = unique_values_count;
+  constexpr auto inverted = scan_type == ScanType::OpNotEquals;
+  if constexpr (scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals) {
+    begin = lower_bound;
+    end = upper_bound;
+  } else if constexpr (scan_type == ScanType::OpLessThan) {
+    end = lower_bound;
+  } else if constexpr (scan_type == ScanType::OpLessThanEquals) {
+    end = upper_bound;
+  } else if constexpr (scan_type == ScanType::OpGreaterThan) {
+    begin = upper_bound;
+  } else {
+    begin = lower_bound;
+  }
+
+  // The bounds alone decide whether no row or all non-NULL rows match.
+  const auto range_is_empty = begin >= end;
+  const auto range_is_full = begin == 0 && end == unique_values_count;
+  if (inverted ? range_is_full : range_is_empty) {
+    return;
+  }
+  const auto& attribute_vector = *segment.attribute_vector();
+  const auto null_value_id = segment.null_value_id();
+  if (inverted ? range_is_empty : range_is_full) {
+    if constexpr (!nullable) {
+      const auto segment_size = static_cast<ChunkOffset>(attribute_vector.size());
+      matches.reserve(matches.size() + segment_size);
+      for (auto offset = ChunkOffset{0}; offset < segment_size; ++offset) {
+        matches.emplace_back(RowID{chunk_id, offset});
+      }
+      return;
+    }
+    // Every value id but the NULL value id matches, i.e., everything outside of [NULL value id, NULL value id + 1).
+    scan_attribute_vector<true>(attribute_vector, null_value_id, ValueID{null_value_id + 1}, null_value_id, chunk_id,
+                                matches);
+    return;
+  }
+
+  scan_attribute_vector<inverted>(attribute_vector, begin, end, null_value_id, chunk_id, matches);
+}
+
+template <typename T, ScanType scan_type, ScanEncoding encoding, bool nullable>
+void scan_kernel(const AbstractSegment& segment, const T& search_value, const ChunkID chunk_id, PosList& matches) {
+  using Segment = EncodedSegment<T, encoding>;
+  DebugAssert(dynamic_cast<const Segment*>(&segment), "The kernel does not match the encoding of the segment.");
+  const auto& typed_segment = static_cast<const Segment&>(segment);
+  constexpr auto comparator = comparator_for<scan_type>();
+
+  if constexpr (encoding == ScanEncoding::Unencoded || encoding == ScanEncoding::External) {
+    const auto* null_words = nullable ? typed_segment.null_values().words().data() : nullptr;
+    if constexpr (std::is_same_v<T, std::string>) {
+      // Comparing GermanStrings decides most rows using the length and prefix, without following a pointer.
+      scan_values<nullable>(typed_segment.values().german_strings(), typed_segment.size(), null_words, comparator,
+                            GermanString{search_value}, chunk_id, matches);
+    } else {
+      scan_values<nullable>(typed_segment.values(), typed_segment.size(), null_words, comparator, search_value,
+                            chunk_id, matches);
+    }
+  } else if constexpr (encoding == ScanEncoding::Dictionary) {
+    scan_dictionary_segment<scan_type, nullable>(typed_segment, search_value, chunk_id, matches);
+  } else {
+    // RunLengthSegment and FrameOfReferenceSegment scan their compressed representation, which also covers the NULL
+    // values. They resolve the comparator once per segment as well.
+    typed_segment.scan(scan_type, search_value, chunk_id, matches);
+  }
+}
+
+template <typename T, size_t index>
+constexpr typename ScanKernels<T>::Kernel make_kernel() {
+  constexpr auto scan_type = static_cast<ScanType>(index / (ENCODING_COUNT * 2));
+  constexpr auto encoding = static_cast<ScanEncoding>(index / 2 % ENCODING_COUNT);
+  constexpr auto nullable = index % 2 == 1;
+  static_assert(kernel_index(scan_type, encoding, nullable) == index);
+  if constexpr (is_supported_encoding<T, encoding>()) {
+    return &scan_kernel<T, scan_type, encoding, nullable>;
+  } else {
+    return nullptr;
+  }
+}
+
+template <typename T, size_t... indices>
+constexpr auto make_kernel_table(std::index_sequence<indices...> /*indices*/) {
+  return std::array<typename ScanKernels<T>::Kernel, sizeof...(indices)>{make_kernel<T, indices>()...};
+}
+
+template <typename T>
+constexpr auto KERNELS = make_kernel_table<T>(std::make_index_sequence<KERNEL_COUNT>{});
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+typename ScanKernels<T>::Kernel ScanKernels<T>::get(const ScanType scan_type, const ScanEncoding encoding,
+                                                    const bool nullable) {
+  const auto kernel = KERNELS<T>[kernel_index(scan_type, encoding, nullable)];
+  Assert(kernel, "Segments of this encoding cannot hold values of this data type.");
+  return kernel;
+}
+
+template <typename T>
+typename ScanKernels<T>::Kernel ScanKernels<T>::select(const AbstractSegment& segment, const ScanType scan_type,
+                                                       const bool may_contain_nulls) {
+  auto kernel = Kernel{};
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      Fail("ReferenceSegments are scanned through the segments they reference.");
+    } else if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      kernel = get(scan_type, ScanEncoding::Unencoded, may_contain_nulls && typed_segment.is_nullable());
+    } else if constexpr (std::is_same_v<SegmentType, ExternalSegment<T>>) {
+      kernel = get(scan_type, ScanEncoding::External, may_contain_nulls && typed_segment.is_nullable());
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      kernel = get(scan_type, ScanEncoding::Dictionary, may_contain_nulls);
+    } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+      kernel = get(scan_type, ScanEncoding::RunLength, may_contain_nulls);
+    } else {
+      kernel = get(scan_type, ScanEncoding::FrameOfReference, may_contain_nulls);
+    }
+  });
+  return kernel;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ScanKernels);
+
+}  // namespace opossum
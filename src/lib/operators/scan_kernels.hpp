@@ -0,0 +1,38 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// Encodings of the segments that scan kernels work on. DictionarySegments with FSST-compressed dictionaries share the
+// kernels of all other DictionarySegments, as their scans only compare value ids.
+enum class ScanEncoding : uint8_t { Unencoded, Dictionary, RunLength, FrameOfReference, External };
+
+// ScanKernels holds a table of scan functions for segments of data type T, with one kernel per ScanType, ScanEncoding,
+// and nullability. Each kernel is a separate instantiation with the comparator, the concrete segment class, and the
+// handling of NULL values fixed at compile time, so its loop contains neither virtual calls nor switches. TableScan
+// selects the kernel once per segment.
+template <typename T>
+class ScanKernels {
+ public:
+  // Appends the positions of all rows of segment that satisfy "value <scan_type> search_value" to matches. The
+  // segment needs to be of the encoding the kernel was selected for.
+  using Kernel = void (*)(const AbstractSegment& segment, const T& search_value, const ChunkID chunk_id,
+                          PosList& matches);
+
+  // Returns the kernel for segments of an encoding. Kernels that are not nullable assume that the segment holds no
+  // NULL values, nullable kernels for unencoded and external segments require the segment to be nullable. Fails for
+  // encodings that do not support T, e.g., FrameOfReference for strings.
+  static Kernel get(const ScanType scan_type, const ScanEncoding encoding, const bool nullable);
+
+  // Returns the kernel for a segment, which must not be a ReferenceSegment. If may_contain_nulls is false, e.g.,
+  // because the statistics of the segment count no NULL values, the selected kernel does not check for them.
+  static Kernel select(const AbstractSegment& segment, const ScanType scan_type, const bool may_contain_nulls);
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(ScanKernels);
+
+}  // namespace opossum
@@ -0,0 +1,207 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <span>
+
+#include "resolve_type.hpp"
+#include "scan_kernels.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "statistics/segment_statistics.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/comparator.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+bool can_prune_chunk(const Chunk& chunk, const ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant& search_value) {
+  const auto statistics = chunk.get_segment_statistics(column_id);
+  return statistics && statistics->can_prune(scan_type, search_value);
+}
+
+// Returns the estimated number of matching rows in a chunk, or 0 if the chunk has no statistics. Reserving this many
+// positions up front avoids repeatedly growing the position list for non-selective predicates.
+size_t estimate_match_count(const Chunk& chunk, const ColumnID column_id, const ScanType scan_type,
+                            const AllTypeVariant& search_value) {
+  const auto statistics = chunk.get_segment_statistics(column_id);
+  if (!statistics) {
+    return 0;
+  }
+  const auto selectivity = statistics->estimate_selectivity(scan_type, search_value);
+  return std::min(static_cast<size_t>(std::ceil(selectivity * static_cast<float>(chunk.size()))),
+                  static_cast<size_t>(chunk.size()));
+}
+
+// Scans the rows a ReferenceSegment points to and appends the matching positions of the referenced table to matches.
+template <typename T>
+void scan_reference_segment(const ReferenceSegment& segment, const ScanType scan_type, const T& search_value,
+                            const AllTypeVariant& search_variant, PosList& matches) {
+  const auto& pos_list = *segment.pos_list();
+  const auto& referenced_table = *segment.referenced_table();
+  const auto referenced_column_id = segment.referenced_column_id();
+  const auto pos_list_size = pos_list.size();
+
+  with_comparator(scan_type, [&](const auto comparator) {
+    // Positions usually come in long runs that point into the same chunk. We resolve the segment type once per run,
+    // and also check whether the statistics of the referenced chunk allow skipping the run altogether. Within a run,
+    // the typed iterator of the referenced segment reads the values without virtual calls.
+    for (auto run_begin = size_t{0}; run_begin < pos_list_size;) {
+      const auto chunk_id = pos_list[run_begin].chunk_id;
+      auto run_end = run_begin + 1;
+      while (run_end < pos_list_size && pos_list[run_end].chunk_id == chunk_id) {
+        ++run_end;
+      }
+
+      if (!pos_list[run_begin].is_null()) {
+        const auto chunk = referenced_table.get_chunk(chunk_id);
+        if (!can_prune_chunk(*chunk, referenced_column_id, scan_type, search_variant)) {
+          const auto positions = std::span<const RowID>{pos_list.data() + run_begin, run_end - run_begin};
+          segment_iterate_filtered<T>(*chunk->get_segment(referenced_column_id), positions, [&](const auto& position) {
+            if (!position.is_null() && comparator(position.value(), search_value)) {
+              matches.emplace_back(positions[position.chunk_offset()]);
+            }
+          });
+        }
+      }
+      run_begin = run_end;
+    }
+  });
+}
+
+}  // namespace
+
+namespace opossum {
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                     const ScanType scan_type, const AllTypeVariant search_value, const size_t max_parallelism)
+    : AbstractOperator(in),
+      _column_id(column_id),
+      _scan_type(scan_type),
+      _search_value(search_value),
+      _max_parallelism(max_parallelism) {}
+
+ColumnID TableScan::column_id() const {
+  return _column_id;
+}
+
+ScanType TableScan::scan_type() const {
+  return _scan_type;
+}
+
+const AllTypeVariant& TableScan::search_value() const {
+  return _search_value;
+}
+
+size_t TableScan::max_parallelism() const {
+  return _max_parallelism;
+}
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(_column_id < input_table->column_count(), "Column with ID does not exist.");
+
+  const auto column_count = input_table->column_count();
+  const auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_nullable(column_id));
+  }
+
+  // Adds a chunk that references the matching rows. If the input chunk consists of ReferenceSegments, the new
+  // segments point to the same table the input segments point to.
+  const auto emplace_output_chunk = [&](const Chunk& input_chunk, const std::shared_ptr<const PosList>& matches) {
+    const auto output_chunk = std::make_shared<Chunk>();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto reference_segment =
+          std::dynamic_pointer_cast<const ReferenceSegment>(input_chunk.get_segment(column_id));
+      if (reference_segment) {
+        output_chunk->add_segment(std::make_shared<ReferenceSegment>(
+            reference_segment->referenced_table(), reference_segment->referenced_column_id(), matches));
+      } else {
+        output_chunk->add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, matches));
+      }
+    }
+    output_table->emplace_chunk(output_chunk);
+  };
+
+  // Comparisons with NULL never match.
+  if (!variant_is_null(_search_value)) {
+    // Every chunk has its own slot for its matches, so the tasks do not need to synchronize.
+    const auto chunk_count = input_table->chunk_count();
+    auto chunk_matches = std::vector<std::shared_ptr<PosList>>(chunk_count);
+
+    resolve_data_type(input_table->column_type(_column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto search_value = type_cast<ColumnDataType>(_search_value);
+
+      const auto scan_chunk = [&](const ChunkID chunk_id) {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        if (chunk->size() == 0 || can_prune_chunk(*chunk, _column_id, _scan_type, _search_value)) {
+          return;
+        }
+
+        const auto matches = std::make_shared<PosList>();
+        matches->reserve(estimate_match_count(*chunk, _column_id, _scan_type, _search_value));
+        const auto& segment = *chunk->get_segment(_column_id);
+        if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+          scan_reference_segment(*reference_segment, _scan_type, search_value, _search_value, *matches);
+        } else {
+          // Without statistics, we do not know whether the segment holds NULL values.
+          const auto statistics = chunk->get_segment_statistics(_column_id);
+          const auto may_contain_nulls = !statistics || statistics->null_count() > 0;
+          const auto kernel = ScanKernels<ColumnDataType>::select(segment, _scan_type, may_contain_nulls);
+          kernel(segment, search_value, chunk_id, *matches);
+        }
+        chunk_matches[chunk_id] = matches;
+      };
+
+      // The tasks claim chunks one by one, so that chunks of different sizes or selectivities balance out.
+      const auto task_count =
+          std::min(_max_parallelism == 0 ? WorkerPool::get().worker_count() : _max_parallelism, size_t{chunk_count});
+      if (task_count <= 1) {
+        for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+          scan_chunk(chunk_id);
+        }
+        return;
+      }
+
+      auto next_chunk_id = std::atomic<ChunkID::base_type>{0};
+      auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+      tasks.reserve(task_count);
+      for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+        tasks.emplace_back(std::make_shared<JobTask>([&]() {
+          for (auto chunk_id = ChunkID{next_chunk_id++}; chunk_id < chunk_count; chunk_id = ChunkID{next_chunk_id++}) {
+            scan_chunk(chunk_id);
+          }
+        }));
+      }
+      schedule_and_wait_for_tasks(tasks);
+    });
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (chunk_matches[chunk_id] && !chunk_matches[chunk_id]->empty()) {
+        emplace_output_chunk(*input_table->get_chunk(chunk_id), chunk_matches[chunk_id]);
+      }
+    }
+  }
+
+  // Even if nothing matches, the output table has a chunk with one (empty) segment per column.
+  if (output_table->row_count() == 0) {
+    const auto input_chunk = input_table->get_chunk(ChunkID{0});
+    if (input_chunk->column_count() == column_count) {
+      emplace_output_chunk(*input_chunk, std::make_shared<PosList>());
+    }
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -1,37 +1,40 @@
 #pragma once
 
 #include "abstract_operator.hpp"
-#include "utils/assert.hpp"
+#include "all_type_variant.hpp"
 
 namespace opossum {
 
+// Operator that selects all rows of its input for which "value in column_id <scan_type> search_value" holds. NULL
+// values never match. The output table consists of ReferenceSegments that point to the rows in the original table,
+// i.e., scans on the output of another TableScan do not introduce another level of indirection.
+//
+// Chunks whose segment statistics (min/max and, for equality predicates, Bloom filters) prove that no row can match
+// are skipped without looking at their rows.
+//
+// The chunks are scanned in parallel: up to max_parallelism JobTasks repeatedly claim the next chunk (morsel) and
+// write its matches into a position list of their own. The output chunks are then created in the order of the input
+// chunks. A max_parallelism of 0 uses one task per worker of the WorkerPool, and 1 scans in the calling thread.
 class TableScan : public AbstractOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const ScanType scan_type,
-            const AllTypeVariant search_value) {
-    // TODO(student) implement it in a source file and change this to a declaration.
-  }
+            const AllTypeVariant search_value, const size_t max_parallelism = 0);
 
-  ColumnID column_id() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  ColumnID column_id() const;
 
-  ScanType scan_type() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  ScanType scan_type() const;
 
-  const AllTypeVariant& search_value() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  const AllTypeVariant& search_value() const;
+
+  size_t max_parallelism() const;
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+  const size_t _max_parallelism;
 };
 
 }  // namespace opossum
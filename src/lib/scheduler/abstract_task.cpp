@@ -0,0 +1,82 @@
+#include "abstract_task.hpp"
+
+#include "scheduler/worker_pool.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractTask::AbstractTask() : _done(_done_promise.get_future().share()) {}
+
+void AbstractTask::set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor) {
+  Assert(!_is_scheduled.test() && !successor->_is_scheduled.test(),
+         "Dependencies need to be set up before the tasks are scheduled.");
+  _successors.emplace_back(successor);
+  ++successor->_pending_dependencies;
+}
+
+const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() const {
+  return _successors;
+}
+
+void AbstractTask::schedule() {
+  Assert(!_is_scheduled.test_and_set(), "Tasks can only be scheduled once.");
+  _on_dependency_resolved();
+}
+
+bool AbstractTask::is_done() const {
+  return _is_done;
+}
+
+void AbstractTask::wait() const {
+  WorkerPool::get().wait(_done);
+  _done.get();
+}
+
+void AbstractTask::_on_dependency_resolved() {
+  if (--_pending_dependencies == 0) {
+    WorkerPool::get().schedule([task = shared_from_this()]() { task->_execute(); });
+  }
+}
+
+void AbstractTask::_execute() {
+  auto exception = _predecessor_exception;
+  if (!exception) {
+    try {
+      _on_execute();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+  }
+
+  if (exception) {
+    // Several predecessors of a successor may fail concurrently. The successor keeps the first exception.
+    for (const auto& successor : _successors) {
+      const auto lock = std::lock_guard{successor->_predecessor_exception_mutex};
+      if (!successor->_predecessor_exception) {
+        successor->_predecessor_exception = exception;
+      }
+    }
+  }
+
+  _is_done = true;
+  if (exception) {
+    _done_promise.set_exception(exception);
+  } else {
+    _done_promise.set_value();
+  }
+
+  for (const auto& successor : _successors) {
+    successor->_on_dependency_resolved();
+  }
+}
+
+void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+  for (const auto& task : tasks) {
+    task->wait();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A unit of work that is run by the WorkerPool once all of its predecessors are done. Tasks form a directed acyclic
+// graph, e.g., one task per operator of a query plan, so that independent parts of the graph run concurrently.
+//
+// Dependencies need to be set up before the tasks are scheduled. A task is handed to the WorkerPool as soon as it is
+// scheduled and its last predecessor is done, whichever happens later, so the order in which tasks are scheduled does
+// not matter. If a task throws, its successors do not run but fail with the same exception.
+class AbstractTask : public std::enable_shared_from_this<AbstractTask>, private Noncopyable {
+ public:
+  AbstractTask();
+  virtual ~AbstractTask() = default;
+
+  // Makes successor wait for this task.
+  void set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor);
+
+  const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
+
+  // Marks the task as ready to run once its predecessors are done. Tasks can only be scheduled once.
+  void schedule();
+
+  bool is_done() const;
+
+  // Blocks until the task is done and rethrows the exception it threw. Workers of the WorkerPool run other jobs in the
+  // meantime, so tasks can wait for sub-tasks they scheduled.
+  void wait() const;
+
+ protected:
+  virtual void _on_execute() = 0;
+
+  // Runs the task and hands its successors to the WorkerPool if they are ready.
+  void _execute();
+
+  // Called when the task was scheduled or when one of its predecessors is done.
+  void _on_dependency_resolved();
+
+  std::vector<std::shared_ptr<AbstractTask>> _successors;
+  // Number of predecessors that are not done yet, plus one until the task is scheduled.
+  std::atomic<size_t> _pending_dependencies{1};
+  std::atomic_flag _is_scheduled;
+  std::atomic<bool> _is_done{false};
+  // The first exception of a predecessor, which the task fails with instead of running. Set before the predecessor
+  // resolves its dependency, so it is visible to whoever hands the task to the WorkerPool.
+  std::mutex _predecessor_exception_mutex;
+  std::exception_ptr _predecessor_exception;
+  std::promise<void> _done_promise;
+  std::shared_future<void> _done;
+};
+
+// Schedules all tasks and waits until they are done. Rethrows the first exception (in the order of tasks).
+void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+}  // namespace opossum
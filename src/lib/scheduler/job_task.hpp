@@ -0,0 +1,20 @@
+#pragma once
+
+#include <functional>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+// Runs a function as a task, e.g., one of the sub-tasks (per chunk or per column) an operator splits its work into.
+class JobTask : public AbstractTask {
+ public:
+  explicit JobTask(const std::function<void()>& function);
+
+ protected:
+  void _on_execute() override;
+
+  const std::function<void()> _function;
+};
+
+}  // namespace opossum
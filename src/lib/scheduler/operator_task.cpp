@@ -0,0 +1,61 @@
+#include "operator_task.hpp"
+
+#include <unordered_map>
+
+#include "operators/abstract_operator.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Creates the tasks of the inputs before the task of op, so that tasks are ordered topologically.
+std::shared_ptr<OperatorTask> add_operator_tasks(
+    const std::shared_ptr<AbstractOperator>& op,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<OperatorTask>>& tasks_by_operator,
+    std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  const auto existing_task = tasks_by_operator.find(op.get());
+  if (existing_task != tasks_by_operator.end()) {
+    return existing_task->second;
+  }
+
+  const auto task = std::make_shared<OperatorTask>(op);
+  for (const auto& input : {op->left_input(), op->right_input()}) {
+    if (input) {
+      // Operators only hand out their inputs as const, but the inputs have not been executed yet. Executing them is
+      // what the plan was built for.
+      const auto input_task =
+          add_operator_tasks(std::const_pointer_cast<AbstractOperator>(input), tasks_by_operator, tasks);
+      input_task->set_as_predecessor_of(task);
+    }
+  }
+  tasks_by_operator.emplace(op.get(), task);
+  tasks.emplace_back(task);
+  return task;
+}
+
+}  // namespace
+
+namespace opossum {
+
+OperatorTask::OperatorTask(const std::shared_ptr<AbstractOperator>& op) : _operator(op) {
+  Assert(_operator, "OperatorTask needs an operator.");
+}
+
+std::vector<std::shared_ptr<AbstractTask>> OperatorTask::make_tasks_from_operator(
+    const std::shared_ptr<AbstractOperator>& op) {
+  auto tasks_by_operator = std::unordered_map<const AbstractOperator*, std::shared_ptr<OperatorTask>>{};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  add_operator_tasks(op, tasks_by_operator, tasks);
+  return tasks;
+}
+
+const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const {
+  return _operator;
+}
+
+void OperatorTask::_on_execute() {
+  _operator->execute();
+}
+
+}  // namespace opossum
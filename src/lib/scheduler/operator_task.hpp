@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// Executes an operator as a task.
+class OperatorTask : public AbstractTask {
+ public:
+  explicit OperatorTask(const std::shared_ptr<AbstractOperator>& op);
+
+  // Creates one task per operator of the plan rooted in op. Every task waits for the tasks of its operator's inputs,
+  // and operators that are the input of several others are only executed once. The tasks are returned in an order in
+  // which they could be executed one after another, i.e., the task of op comes last.
+  static std::vector<std::shared_ptr<AbstractTask>> make_tasks_from_operator(
+      const std::shared_ptr<AbstractOperator>& op);
+
+  const std::shared_ptr<AbstractOperator>& get_operator() const;
+
+ protected:
+  void _on_execute() override;
+
+  const std::shared_ptr<AbstractOperator> _operator;
+};
+
+}  // namespace opossum
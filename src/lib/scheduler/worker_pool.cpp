@@ -0,0 +1,123 @@
+#include "worker_pool.hpp"
+
+#include <algorithm>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Identifies the pool and worker the current thread belongs to, if any.
+thread_local const WorkerPool* current_pool = nullptr;
+thread_local size_t current_worker_id = 0;
+
+}  // namespace
+
+namespace opossum {
+
+WorkerPool& WorkerPool::get() {
+  static auto instance = WorkerPool{std::max(std::thread::hardware_concurrency(), 1u)};
+  return instance;
+}
+
+WorkerPool::WorkerPool(const size_t worker_count) {
+  Assert(worker_count > 0, "A worker pool needs at least one worker.");
+  _queues.reserve(worker_count);
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _queues.emplace_back(std::make_unique<JobQueue>());
+  }
+  _workers.reserve(worker_count);
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _workers.emplace_back(&WorkerPool::_work, this, worker_id);
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    const auto lock = std::lock_guard{_mutex};
+    _shutting_down = true;
+  }
+  _condition.notify_all();
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+size_t WorkerPool::worker_count() const {
+  return _workers.size();
+}
+
+void WorkerPool::schedule(std::function<void()> job) {
+  const auto queue_id = _is_own_worker() ? current_worker_id : _next_queue++ % _queues.size();
+  {
+    auto& queue = *_queues[queue_id];
+    const auto lock = std::lock_guard{queue.mutex};
+    queue.jobs.emplace_back(std::move(job));
+  }
+  ++_pending_jobs;
+  {
+    // Locking the mutex makes sure that a worker that is about to sleep sees the job.
+    const auto lock = std::lock_guard{_mutex};
+  }
+  _condition.notify_one();
+}
+
+std::function<void()> WorkerPool::_take_job(const size_t worker_id) {
+  {
+    auto& queue = *_queues[worker_id];
+    const auto lock = std::lock_guard{queue.mutex};
+    if (!queue.jobs.empty()) {
+      auto job = std::move(queue.jobs.back());
+      queue.jobs.pop_back();
+      --_pending_jobs;
+      return job;
+    }
+  }
+
+  const auto queue_count = _queues.size();
+  for (auto offset = size_t{1}; offset < queue_count; ++offset) {
+    auto& queue = *_queues[(worker_id + offset) % queue_count];
+    const auto lock = std::lock_guard{queue.mutex};
+    if (!queue.jobs.empty()) {
+      auto job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+      --_pending_jobs;
+      return job;
+    }
+  }
+  return nullptr;
+}
+
+void WorkerPool::_work(const size_t worker_id) {
+  current_pool = this;
+  current_worker_id = worker_id;
+  while (true) {
+    if (const auto job = _take_job(worker_id)) {
+      job();
+      continue;
+    }
+
+    auto lock = std::unique_lock{_mutex};
+    _condition.wait(lock, [this]() { return _shutting_down || _pending_jobs > 0; });
+    if (_shutting_down && _pending_jobs <= 0) {
+      return;
+    }
+  }
+}
+
+bool WorkerPool::_is_own_worker() const {
+  return current_pool == this;
+}
+
+void WorkerPool::_run_jobs_until(const std::function<bool()>& is_done) {
+  while (!is_done()) {
+    if (const auto job = _take_job(current_worker_id)) {
+      job();
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A fixed number of worker threads that run jobs, used for work that is split into many small pieces, e.g., one job
+// per segment when compressing chunks. Every worker has its own queue. Jobs scheduled by a worker go to the back of its
+// own queue and are taken from there first (LIFO), which keeps their data in the worker's caches. Jobs scheduled by
+// other threads are distributed round-robin. Idle workers steal the oldest jobs from the front of other queues, so all
+// workers stay busy without creating a thread per job.
+class WorkerPool : private Noncopyable {
+ public:
+  // Returns the pool shared by the whole process, which has one worker per hardware thread.
+  static WorkerPool& get();
+
+  explicit WorkerPool(const size_t worker_count);
+
+  // Runs the remaining jobs and joins the workers.
+  ~WorkerPool();
+
+  size_t worker_count() const;
+
+  // Schedules a job. Jobs must not throw, as there is nobody to pass the exception on to. Use submit() instead.
+  void schedule(std::function<void()> job);
+
+  // Schedules a functor and returns a future that holds its result or the exception it threw.
+  template <typename Functor>
+  std::future<std::invoke_result_t<Functor>> submit(Functor&& functor) {
+    using Result = std::invoke_result_t<Functor>;
+    // std::function needs to be copyable, so the packaged task is shared.
+    const auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Functor>(functor));
+    auto result = task->get_future();
+    schedule([task]() { (*task)(); });
+    return result;
+  }
+
+  // Blocks until the future (or shared future) is ready. Workers of this pool run other jobs in the meantime, so that
+  // jobs can wait for the jobs they scheduled without blocking a worker (or deadlocking if all workers wait).
+  template <typename Future>
+  void wait(const Future& future) {
+    if (!_is_own_worker()) {
+      future.wait();
+      return;
+    }
+    _run_jobs_until([&future]() { return future.wait_for(std::chrono::seconds{0}) == std::future_status::ready; });
+  }
+
+ protected:
+  struct JobQueue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> jobs;
+  };
+
+  void _work(const size_t worker_id);
+
+  // Takes a job from the worker's own queue or steals one from another queue.
+  std::function<void()> _take_job(const size_t worker_id);
+
+  // Returns whether the calling thread is one of this pool's workers.
+  bool _is_own_worker() const;
+
+  // Runs jobs on the calling worker until is_done returns true.
+  void _run_jobs_until(const std::function<bool()>& is_done);
+
+  std::vector<std::unique_ptr<JobQueue>> _queues;
+  std::atomic<size_t> _next_queue{0};
+  // Number of jobs in all queues. It may be briefly negative, as a job can be taken before it is counted.
+  std::atomic<int64_t> _pending_jobs{0};
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _shutting_down = false;
+  std::vector<std::thread> _workers;
+};
+
+}  // namespace opossum
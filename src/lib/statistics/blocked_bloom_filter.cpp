@@ -0,0 +1,69 @@
+#include "blocked_bloom_filter.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// Odd constants that derive the bit positions of the eight words from a single 32-bit hash (taken from Parquet).
+constexpr auto SALTS = std::array<uint32_t, opossum::BlockedBloomFilter::WORDS_PER_BLOCK>{
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+constexpr auto BITS_PER_BLOCK = opossum::BlockedBloomFilter::WORDS_PER_BLOCK * 32;
+
+// Finalizer of MurmurHash3, which spreads every input bit over all output bits.
+uint64_t mix(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace
+
+namespace opossum {
+
+BlockedBloomFilter::BlockedBloomFilter(const size_t distinct_count, const size_t bits_per_value)
+    : _blocks(std::max((distinct_count * bits_per_value + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK, size_t{1})) {}
+
+std::pair<size_t, BlockedBloomFilter::Block> BlockedBloomFilter::_block_and_mask(const size_t hash) const {
+  const auto mixed_hash = mix(hash);
+  // The upper 32 bits select the block without a modulo operation, the lower 32 bits select the bits in the block.
+  const auto block_index = static_cast<size_t>(((mixed_hash >> 32) * _blocks.size()) >> 32);
+  const auto key = static_cast<uint32_t>(mixed_hash);
+  auto mask = Block{};
+  for (auto word = size_t{0}; word < WORDS_PER_BLOCK; ++word) {
+    mask[word] = uint32_t{1} << ((key * SALTS[word]) >> 27);
+  }
+  return {block_index, mask};
+}
+
+void BlockedBloomFilter::insert(const size_t hash) {
+  const auto [block_index, mask] = _block_and_mask(hash);
+  auto& block = _blocks[block_index];
+  for (auto word = size_t{0}; word < WORDS_PER_BLOCK; ++word) {
+    block[word] |= mask[word];
+  }
+}
+
+bool BlockedBloomFilter::may_contain(const size_t hash) const {
+  const auto [block_index, mask] = _block_and_mask(hash);
+  const auto& block = _blocks[block_index];
+  // No early exit, so that the compiler can vectorize the loop.
+  auto missing_bits = uint32_t{0};
+  for (auto word = size_t{0}; word < WORDS_PER_BLOCK; ++word) {
+    missing_bits |= mask[word] & ~block[word];
+  }
+  return missing_bits == 0;
+}
+
+size_t BlockedBloomFilter::block_count() const {
+  return _blocks.size();
+}
+
+size_t BlockedBloomFilter::estimate_memory_usage() const {
+  return sizeof(Block) * _blocks.capacity();
+}
+
+}  // namespace opossum
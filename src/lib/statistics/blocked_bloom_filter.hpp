@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// BlockedBloomFilter is a Bloom filter whose bits are split into blocks of 256 bits (eight 32-bit words). A value only
+// sets and tests bits within a single block, one bit per word. Thus, a lookup touches a single cache line and the
+// eight bit tests can be done with a few (vectorizable) instructions. The layout follows the split block Bloom filter
+// used by Apache Parquet.
+//
+// The filter works on hashes, so callers hash their values (e.g., with std::hash) before inserting or testing them.
+// The hash is mixed again internally, as std::hash is the identity for integers.
+class BlockedBloomFilter : private Noncopyable {
+ public:
+  static constexpr auto WORDS_PER_BLOCK = size_t{8};
+  static constexpr auto DEFAULT_BITS_PER_VALUE = size_t{10};
+
+  // Creates an empty filter that is sized for the given number of distinct values. With the default of ten bits per
+  // value, the false positive rate is about 1%.
+  explicit BlockedBloomFilter(const size_t distinct_count, const size_t bits_per_value = DEFAULT_BITS_PER_VALUE);
+
+  void insert(const size_t hash);
+
+  // Returns false if a value with the given hash has definitely not been inserted.
+  bool may_contain(const size_t hash) const;
+
+  // Returns the number of 256-bit blocks.
+  size_t block_count() const;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  using Block = std::array<uint32_t, WORDS_PER_BLOCK>;
+
+  std::vector<Block> _blocks;
+
+  // Returns the block a hash belongs to and the bit to test or set in each of its words.
+  std::pair<size_t, Block> _block_and_mask(const size_t hash) const;
+};
+
+}  // namespace opossum
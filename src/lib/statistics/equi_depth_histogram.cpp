@@ -0,0 +1,167 @@
+#include "equi_depth_histogram.hpp"
+
+#include <algorithm>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Maps a value to a number, so that we can interpolate within a bin. For strings, the first bytes are interpreted as
+// digits in base 256, which preserves their lexicographic order for all practical purposes.
+template <typename T>
+double to_position(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    constexpr auto PREFIX_LENGTH = size_t{6};
+    auto position = 0.0;
+    for (auto index = size_t{0}; index < PREFIX_LENGTH; ++index) {
+      position = position * 256.0 + (index < value.size() ? static_cast<uint8_t>(value[index]) : 0.0);
+    }
+    return position;
+  } else {
+    return static_cast<double>(value);
+  }
+}
+
+// Returns the share of the values in [minimum, maximum] that are smaller than value, assuming that minimum < value <=
+// maximum and that the values are distributed uniformly.
+template <typename T>
+double share_less_than(const T& minimum, const T& maximum, const T& value) {
+  if constexpr (std::is_integral_v<T>) {
+    return (static_cast<double>(value) - static_cast<double>(minimum)) /
+           (static_cast<double>(maximum) - static_cast<double>(minimum) + 1.0);
+  } else {
+    const auto width = to_position(maximum) - to_position(minimum);
+    if (width <= 0.0) {
+      return 0.5;
+    }
+    return std::clamp((to_position(value) - to_position(minimum)) / width, 0.0, 1.0);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+EquiDepthHistogram<T>::EquiDepthHistogram(const std::vector<std::pair<T, ChunkOffset>>& value_counts,
+                                          const size_t max_bin_count) {
+  Assert(max_bin_count > 0, "A histogram needs at least one bin.");
+  for (const auto& [value, count] : value_counts) {
+    _total_count += count;
+  }
+  const auto target_height = (_total_count + max_bin_count - 1) / max_bin_count;
+
+  for (const auto& [value, count] : value_counts) {
+    // Values that fill a bin on their own get a separate bin. Otherwise, the uniformity assumption would spread their
+    // frequency over the other values of the bin.
+    if (_bins.empty() || _bins.back().height >= target_height || count >= target_height) {
+      _bins.emplace_back(Bin{value, value, 0, 0});
+    }
+    auto& bin = _bins.back();
+    DebugAssert(bin.maximum <= value, "Values have to be sorted.");
+    bin.maximum = value;
+    bin.height += count;
+    ++bin.distinct_count;
+  }
+}
+
+template <typename T>
+std::shared_ptr<EquiDepthHistogram<T>> EquiDepthHistogram<T>::merge(
+    const std::vector<std::shared_ptr<const EquiDepthHistogram<T>>>& histograms, const size_t max_bin_count) {
+  Assert(max_bin_count > 0, "A histogram needs at least one bin.");
+  // The constructor is protected, so we cannot use std::make_shared here.
+  auto merged_histogram = std::shared_ptr<EquiDepthHistogram<T>>(new EquiDepthHistogram<T>());
+  auto bins = std::vector<Bin>{};
+  for (const auto& histogram : histograms) {
+    bins.insert(bins.end(), histogram->_bins.begin(), histogram->_bins.end());
+    merged_histogram->_total_count += histogram->_total_count;
+  }
+
+  // We combine adjacent bins (ordered by their maximum) until they reach the target height. The bins of different
+  // histograms may overlap, so the distinct count of a combined bin is only an upper bound.
+  std::sort(bins.begin(), bins.end(), [](const auto& lhs, const auto& rhs) { return lhs.maximum < rhs.maximum; });
+  const auto target_height = (merged_histogram->_total_count + max_bin_count - 1) / max_bin_count;
+  auto& merged_bins = merged_histogram->_bins;
+  for (const auto& bin : bins) {
+    if (merged_bins.empty() || merged_bins.back().height >= target_height) {
+      merged_bins.emplace_back(bin);
+      continue;
+    }
+    auto& merged_bin = merged_bins.back();
+    merged_bin.minimum = std::min(merged_bin.minimum, bin.minimum);
+    merged_bin.maximum = bin.maximum;
+    merged_bin.height += bin.height;
+    merged_bin.distinct_count = std::min(merged_bin.distinct_count + bin.distinct_count, merged_bin.height);
+  }
+  return merged_histogram;
+}
+
+template <typename T>
+const std::vector<typename EquiDepthHistogram<T>::Bin>& EquiDepthHistogram<T>::bins() const {
+  return _bins;
+}
+
+template <typename T>
+float EquiDepthHistogram<T>::_estimate_equals(const T& value) const {
+  auto estimate = 0.0;
+  for (const auto& bin : _bins) {
+    if (bin.minimum <= value && value <= bin.maximum) {
+      estimate += static_cast<double>(bin.height) / static_cast<double>(bin.distinct_count);
+    }
+  }
+  return static_cast<float>(estimate);
+}
+
+template <typename T>
+float EquiDepthHistogram<T>::_estimate_less_than(const T& value) const {
+  auto estimate = 0.0;
+  for (const auto& bin : _bins) {
+    if (bin.maximum < value) {
+      estimate += static_cast<double>(bin.height);
+    } else if (bin.minimum < value) {
+      estimate += static_cast<double>(bin.height) * share_less_than(bin.minimum, bin.maximum, value);
+    }
+  }
+  return static_cast<float>(estimate);
+}
+
+template <typename T>
+float EquiDepthHistogram<T>::estimate_cardinality(const ScanType scan_type, const T& search_value) const {
+  const auto total_count = static_cast<float>(_total_count);
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _estimate_equals(search_value);
+    case ScanType::OpNotEquals:
+      return std::max(total_count - _estimate_equals(search_value), 0.0f);
+    case ScanType::OpLessThan:
+      return _estimate_less_than(search_value);
+    case ScanType::OpLessThanEquals:
+      return std::min(_estimate_less_than(search_value) + _estimate_equals(search_value), total_count);
+    case ScanType::OpGreaterThan:
+      return std::max(total_count - _estimate_less_than(search_value) - _estimate_equals(search_value), 0.0f);
+    case ScanType::OpGreaterThanEquals:
+      return total_count - _estimate_less_than(search_value);
+  }
+  Fail("Unsupported scan type.");
+}
+
+template <typename T>
+float EquiDepthHistogram<T>::estimate_cardinality(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  // Comparisons with NULL never match.
+  if (variant_is_null(search_value)) {
+    return 0.0f;
+  }
+  return estimate_cardinality(scan_type, type_cast<T>(search_value));
+}
+
+template <typename T>
+size_t EquiDepthHistogram<T>::total_count() const {
+  return _total_count;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(EquiDepthHistogram);
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// AbstractHistogram is the abstract super class for histograms, which estimate how many values satisfy a predicate.
+class AbstractHistogram : private Noncopyable {
+ public:
+  AbstractHistogram() = default;
+  virtual ~AbstractHistogram() = default;
+
+  // Returns the estimated number of values that satisfy "value <scan_type> search_value".
+  virtual float estimate_cardinality(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // Returns the number of values the histogram was built from.
+  virtual size_t total_count() const = 0;
+};
+
+// EquiDepthHistogram splits the (non-NULL) values into bins that hold about the same number of values. Each bin
+// stores its minimum, maximum, the number of values (height), and the number of distinct values. Within a bin, values
+// are assumed to be distributed uniformly. Frequent values thus get narrow bins, which keeps estimates accurate for
+// skewed data.
+//
+// Histograms are built per chunk and can be merged into a histogram of the whole column. After merging, bins may
+// overlap, which estimate_cardinality() takes into account.
+template <typename T>
+class EquiDepthHistogram : public AbstractHistogram {
+ public:
+  static constexpr auto DEFAULT_BIN_COUNT = size_t{32};
+
+  struct Bin {
+    T minimum;
+    T maximum;
+    size_t height;
+    size_t distinct_count;
+  };
+
+  // Creates a histogram from the sorted, distinct values of a segment and the number of their occurrences. A value is
+  // never split across bins. Values that are frequent enough to fill a bin get a bin of their own, so the histogram
+  // has at most twice max_bin_count bins.
+  explicit EquiDepthHistogram(const std::vector<std::pair<T, ChunkOffset>>& value_counts,
+                              const size_t max_bin_count = DEFAULT_BIN_COUNT);
+
+  // Merges several histograms (e.g., those of all chunks of a column) into one with at most max_bin_count bins.
+  static std::shared_ptr<EquiDepthHistogram<T>> merge(
+      const std::vector<std::shared_ptr<const EquiDepthHistogram<T>>>& histograms,
+      const size_t max_bin_count = DEFAULT_BIN_COUNT);
+
+  const std::vector<Bin>& bins() const;
+
+  float estimate_cardinality(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  // Typed version of estimate_cardinality.
+  float estimate_cardinality(const ScanType scan_type, const T& search_value) const;
+
+  size_t total_count() const final;
+
+ protected:
+  EquiDepthHistogram() = default;
+
+  std::vector<Bin> _bins;
+  size_t _total_count{0};
+
+  float _estimate_equals(const T& value) const;
+  float _estimate_less_than(const T& value) const;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(EquiDepthHistogram);
+
+}  // namespace opossum
@@ -0,0 +1,235 @@
+#include "segment_statistics.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "blocked_bloom_filter.hpp"
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/external_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Number of value ids that are decoded at once when counting the values of a DictionarySegment.
+constexpr auto DECODE_BLOCK_SIZE = size_t{2048};
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+SegmentStatistics<T>::SegmentStatistics(const AbstractSegment& segment, const bool build_bloom_filter) {
+  const auto value_counts = _count_values(segment);
+  if (!value_counts.empty()) {
+    _min = value_counts.front().first;
+    _max = value_counts.back().first;
+  }
+  _distinct_count = static_cast<ChunkOffset>(value_counts.size());
+  _histogram = std::make_shared<EquiDepthHistogram<T>>(value_counts);
+
+  if (build_bloom_filter) {
+    _bloom_filter = std::make_shared<BlockedBloomFilter>(value_counts.size());
+    for (const auto& [value, count] : value_counts) {
+      _bloom_filter->insert(std::hash<T>{}(value));
+    }
+  }
+}
+
+template <typename T>
+std::vector<std::pair<T, ChunkOffset>> SegmentStatistics<T>::_count_values(const AbstractSegment& segment) {
+  auto value_counts = std::vector<std::pair<T, ChunkOffset>>{};
+
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    // The dictionary already holds the sorted distinct values. The value ids are decoded block-wise, so that we do not
+    // need a virtual call per row.
+    const auto unique_values_count = dictionary_segment->unique_values_count();
+    auto counts = std::vector<ChunkOffset>(unique_values_count);
+    const auto& attribute_vector = *dictionary_segment->attribute_vector();
+    const auto null_value_id = dictionary_segment->null_value_id();
+    const auto segment_size = attribute_vector.size();
+    auto value_ids = std::vector<ValueID>{};
+    for (auto begin = size_t{0}; begin < segment_size; begin += DECODE_BLOCK_SIZE) {
+      const auto end = std::min(begin + DECODE_BLOCK_SIZE, segment_size);
+      value_ids.clear();
+      attribute_vector.decode_range(begin, end, value_ids);
+      for (const auto value_id : value_ids) {
+        if (value_id == null_value_id) {
+          ++_null_count;
+        } else {
+          ++counts[value_id];
+        }
+      }
+    }
+
+    value_counts.reserve(unique_values_count);
+    for (auto value_id = ValueID{0}; value_id < unique_values_count; ++value_id) {
+      value_counts.emplace_back(dictionary_segment->value_of_value_id(value_id), counts[value_id]);
+    }
+    return value_counts;
+  }
+
+  // ValueSegments and ExternalSegments both store plain values.
+  const auto count_plain_values = [&](const auto& plain_segment) {
+    const auto& values = plain_segment.values();
+    const auto segment_size = plain_segment.size();
+    const auto is_nullable = plain_segment.is_nullable();
+    value_counts.reserve(segment_size);
+    for (auto offset = ChunkOffset{0}; offset < segment_size; ++offset) {
+      if (is_nullable && plain_segment.null_values()[offset]) {
+        ++_null_count;
+      } else {
+        value_counts.emplace_back(values[offset], 1);
+      }
+    }
+  };
+
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    count_plain_values(*value_segment);
+  } else if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    // Each run contributes its value once, weighted with the run length.
+    const auto& run_values = run_length_segment->values();
+    const auto& run_null_values = run_length_segment->null_values();
+    const auto& end_positions = run_length_segment->end_positions();
+    for (auto run_index = size_t{0}; run_index < run_values.size(); ++run_index) {
+      const auto run_begin = run_index == 0 ? ChunkOffset{0} : end_positions[run_index - 1] + 1;
+      const auto run_length = end_positions[run_index] + 1 - run_begin;
+      if (run_null_values[run_index]) {
+        _null_count += run_length;
+      } else {
+        value_counts.emplace_back(run_values[run_index], run_length);
+      }
+    }
+  } else if (dynamic_cast<const ReferenceSegment*>(&segment)) {
+    // ReferenceSegments, e.g., of scan outputs, are resolved chunk by chunk through the segments they point to. NULL
+    // row ids are NULL values.
+    value_counts.reserve(segment.size());
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        ++_null_count;
+      } else {
+        value_counts.emplace_back(T{position.value()}, 1);
+      }
+    });
+  } else {
+    auto is_supported_segment = false;
+    if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+      if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+        is_supported_segment = true;
+        const auto segment_size = frame_of_reference_segment->size();
+        value_counts.reserve(segment_size);
+        for (auto offset = ChunkOffset{0}; offset < segment_size; ++offset) {
+          const auto value = frame_of_reference_segment->get_typed_value(offset);
+          if (value) {
+            value_counts.emplace_back(*value, 1);
+          } else {
+            ++_null_count;
+          }
+        }
+      }
+    }
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (const auto* external_segment = dynamic_cast<const ExternalSegment<T>*>(&segment)) {
+        is_supported_segment = true;
+        count_plain_values(*external_segment);
+      }
+    }
+    Assert(is_supported_segment, "Statistics are not supported for this segment type.");
+  }
+
+  // Sorts the values and combines the counts of equal values.
+  std::sort(value_counts.begin(), value_counts.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  auto distinct_end = value_counts.begin();
+  for (auto iterator = value_counts.begin(); iterator != value_counts.end(); ++iterator) {
+    if (distinct_end != value_counts.begin() && std::prev(distinct_end)->first == iterator->first) {
+      std::prev(distinct_end)->second += iterator->second;
+    } else {
+      if (distinct_end != iterator) {
+        *distinct_end = std::move(*iterator);
+      }
+      ++distinct_end;
+    }
+  }
+  value_counts.erase(distinct_end, value_counts.end());
+  return value_counts;
+}
+
+template <typename T>
+const std::optional<T>& SegmentStatistics<T>::min() const {
+  return _min;
+}
+
+template <typename T>
+const std::optional<T>& SegmentStatistics<T>::max() const {
+  return _max;
+}
+
+template <typename T>
+std::shared_ptr<const EquiDepthHistogram<T>> SegmentStatistics<T>::histogram() const {
+  return _histogram;
+}
+
+template <typename T>
+std::shared_ptr<const BlockedBloomFilter> SegmentStatistics<T>::bloom_filter() const {
+  return _bloom_filter;
+}
+
+template <typename T>
+bool SegmentStatistics<T>::can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  if (variant_is_null(search_value)) {
+    return false;
+  }
+  // Segments that contain only NULL values (or no values at all) can never match.
+  if (!_min) {
+    return true;
+  }
+
+  const auto value = type_cast<T>(search_value);
+  const auto& min = *_min;
+  const auto& max = *_max;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return value < min || value > max || (_bloom_filter && !_bloom_filter->may_contain(std::hash<T>{}(value)));
+    case ScanType::OpNotEquals:
+      return min == value && max == value;
+    case ScanType::OpLessThan:
+      return min >= value;
+    case ScanType::OpLessThanEquals:
+      return min > value;
+    case ScanType::OpGreaterThan:
+      return max <= value;
+    case ScanType::OpGreaterThanEquals:
+      return max < value;
+  }
+  Fail("Unsupported scan type.");
+}
+
+template <typename T>
+float SegmentStatistics<T>::estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  const auto row_count = _histogram->total_count() + _null_count;
+  if (row_count == 0 || can_prune(scan_type, search_value)) {
+    return 0.0f;
+  }
+  return _histogram->estimate_cardinality(scan_type, search_value) / static_cast<float>(row_count);
+}
+
+template <typename T>
+ChunkOffset SegmentStatistics<T>::null_count() const {
+  return _null_count;
+}
+
+template <typename T>
+ChunkOffset SegmentStatistics<T>::distinct_count() const {
+  return _distinct_count;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(SegmentStatistics);
+
+}  // namespace opossum
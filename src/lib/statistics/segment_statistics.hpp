@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "all_type_variant.hpp"
+#include "equi_depth_histogram.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+class BlockedBloomFilter;
+
+// AbstractSegmentStatistics is the abstract super class for the statistics of a segment. They are computed when a
+// chunk is compressed and allow operators to skip whole chunks (zone map pruning) and to estimate the size of their
+// results.
+class AbstractSegmentStatistics : private Noncopyable {
+ public:
+  AbstractSegmentStatistics() = default;
+  virtual ~AbstractSegmentStatistics() = default;
+
+  // Returns whether the statistics prove that no row of the segment satisfies "value <scan_type> search_value". NULL
+  // values never satisfy a predicate. If false is returned, some rows may or may not match.
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // Returns the estimated share of rows (including NULL rows) that satisfy "value <scan_type> search_value".
+  virtual float estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // Returns the number of NULL values.
+  virtual ChunkOffset null_count() const = 0;
+
+  // Returns the number of distinct non-NULL values.
+  virtual ChunkOffset distinct_count() const = 0;
+};
+
+// SegmentStatistics holds the minimum, maximum, NULL count, distinct count, and an equi-depth histogram of a segment.
+// For DictionarySegments, the sorted distinct values are read from the dictionary and only the value ids are counted.
+// For other segment types, the non-NULL values are collected and sorted.
+//
+// Optionally, a Bloom filter over the distinct values is built. It allows pruning equality predicates on values that
+// lie between the minimum and the maximum but do not occur in the segment, which is common for point lookups on
+// high-cardinality columns.
+template <typename T>
+class SegmentStatistics : public AbstractSegmentStatistics {
+ public:
+  // Computes the statistics of a ValueSegment, DictionarySegment, RunLengthSegment, FrameOfReferenceSegment, or
+  // ReferenceSegment.
+  explicit SegmentStatistics(const AbstractSegment& segment, const bool build_bloom_filter = false);
+
+  // Returns the smallest non-NULL value, or std::nullopt if there is none.
+  const std::optional<T>& min() const;
+
+  // Returns the largest non-NULL value, or std::nullopt if there is none.
+  const std::optional<T>& max() const;
+
+  // Returns the histogram over the non-NULL values.
+  std::shared_ptr<const EquiDepthHistogram<T>> histogram() const;
+
+  // Returns the Bloom filter over the distinct values, or nullptr if none was built.
+  std::shared_ptr<const BlockedBloomFilter> bloom_filter() const;
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  float estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  ChunkOffset null_count() const final;
+
+  ChunkOffset distinct_count() const final;
+
+ protected:
+  std::optional<T> _min;
+  std::optional<T> _max;
+  ChunkOffset _null_count{0};
+  ChunkOffset _distinct_count{0};
+  std::shared_ptr<EquiDepthHistogram<T>> _histogram;
+  std::shared_ptr<BlockedBloomFilter> _bloom_filter;
+
+  // Returns the sorted, distinct non-NULL values of a segment together with the number of their occurrences, and
+  // counts the NULL values.
+  std::vector<std::pair<T, ChunkOffset>> _count_values(const AbstractSegment& segment);
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(SegmentStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#include "table_statistics.hpp"
+
+#include <algorithm>
+
+#include "equi_depth_histogram.hpp"
+#include "resolve_type.hpp"
+#include "segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableStatistics::TableStatistics(const Table& table) : _row_count(table.row_count()) {
+  const auto column_count = table.column_count();
+  const auto chunk_count = table.chunk_count();
+  _histograms.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      auto chunk_histograms = std::vector<std::shared_ptr<const EquiDepthHistogram<ColumnDataType>>>{};
+      chunk_histograms.reserve(chunk_count);
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table.get_chunk(chunk_id);
+        auto statistics = std::dynamic_pointer_cast<const SegmentStatistics<ColumnDataType>>(
+            chunk->get_segment_statistics(column_id));
+        if (!statistics) {
+          statistics = std::make_shared<SegmentStatistics<ColumnDataType>>(*chunk->get_segment(column_id));
+        }
+        chunk_histograms.emplace_back(statistics->histogram());
+      }
+      _histograms.emplace_back(EquiDepthHistogram<ColumnDataType>::merge(chunk_histograms));
+    });
+  }
+}
+
+uint64_t TableStatistics::row_count() const {
+  return _row_count;
+}
+
+std::shared_ptr<const AbstractHistogram> TableStatistics::histogram(const ColumnID column_id) const {
+  Assert(column_id < _histograms.size(), "Column with ID does not exist.");
+  return _histograms[column_id];
+}
+
+float TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                            const AllTypeVariant& search_value) const {
+  if (_row_count == 0) {
+    return 0.0f;
+  }
+  const auto cardinality = histogram(column_id)->estimate_cardinality(scan_type, search_value);
+  return std::clamp(cardinality / static_cast<float>(_row_count), 0.0f, 1.0f);
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractHistogram;
+class Table;
+
+// TableStatistics holds one histogram per column, which is merged from the histograms of all chunks, and estimates
+// the selectivity of predicates on the whole table. Chunks that have no statistics yet (e.g., the uncompressed last
+// chunk or the chunks of a scan output) are analyzed on the fly. The statistics are a snapshot and do not reflect later
+// changes to the table.
+class TableStatistics : private Noncopyable {
+ public:
+  explicit TableStatistics(const Table& table);
+
+  // Returns the number of rows (including NULL rows) the statistics were built from.
+  uint64_t row_count() const;
+
+  // Returns the histogram over the non-NULL values of a column.
+  std::shared_ptr<const AbstractHistogram> histogram(const ColumnID column_id) const;
+
+  // Returns the estimated share of rows that satisfy "value in column_id <scan_type> search_value".
+  float estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                             const AllTypeVariant& search_value) const;
+
+ protected:
+  uint64_t _row_count;
+  std::vector<std::shared_ptr<const AbstractHistogram>> _histograms;
+};
+
+}  // namespace opossum
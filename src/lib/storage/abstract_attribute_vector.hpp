@@ -20,11 +20,18 @@ class AbstractAttributeVector : private Noncopyable {
   // Sets the value id at a given position.
   virtual void set(const size_t index, const ValueID value_id) = 0;
 
+  // Writes the value ids in [begin, end) to the given output vector, which is resized accordingly. Prefer this over
+  // calling get() in a loop, as implementations can decode whole blocks at once.
+  virtual void decode_range(const size_t begin, const size_t end, std::vector<ValueID>& output) const = 0;
+
   // Returns the number of values.
   virtual size_t size() const = 0;
 
   // Returns the width of biggest value id in bytes.
   virtual AttributeVectorWidth width() const = 0;
+
+  // Returns the calculated memory usage of the stored value ids.
+  virtual size_t estimate_memory_usage() const = 0;
 };
 
 }  // namespace opossum
@@ -0,0 +1,137 @@
+#include "bit_packed_vector.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "dictionary_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BitPackedVector::BitPackedVector(const std::vector<ValueID>& values, const uint8_t bit_width)
+    : _size(values.size()), _bit_width(bit_width) {
+  Assert(bit_width >= 1 && bit_width <= 32, "Bit width has to be in [1, 32].");
+  _mask = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+
+  const auto bit_count = static_cast<uint64_t>(_size) * _bit_width;
+  _words = Buffer<uint64_t>{std::vector<uint64_t>((bit_count + 63) / 64 + 1)};
+  for (auto index = size_t{0}; index < _size; ++index) {
+    set(index, values[index]);
+  }
+}
+
+BitPackedVector::BitPackedVector(Buffer<uint64_t>&& words, const size_t size, const uint8_t bit_width)
+    : _words(std::move(words)), _size(size), _bit_width(bit_width) {
+  Assert(bit_width >= 1 && bit_width <= 32, "Bit width has to be in [1, 32].");
+  _mask = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+  const auto bit_count = static_cast<uint64_t>(_size) * _bit_width;
+  Assert(_words.size() == (bit_count + 63) / 64 + 1, "Number of words does not match the size and bit width.");
+}
+
+ValueID BitPackedVector::get(const size_t index) const {
+  Assert(index < _size, "Invalid index given.");
+  const auto bit_offset = static_cast<uint64_t>(index) * _bit_width;
+  const auto word_index = bit_offset / 64;
+  const auto shift = bit_offset % 64;
+
+  auto value = _words[word_index] >> shift;
+  if (shift + _bit_width > 64) {
+    value |= _words[word_index + 1] << (64 - shift);
+  }
+  return ValueID{static_cast<uint32_t>(value & _mask)};
+}
+
+void BitPackedVector::set(const size_t index, const ValueID value_id) {
+  Assert(index < _size, "Index out of bounds for vector and size of vector is fixed (may not be increased).");
+  Assert(value_id == NULL_VALUE_ID || value_id <= _mask,
+         "Passed value " + std::to_string(value_id) + " is too big to be stored with " + std::to_string(_bit_width) +
+             " bits.");
+  const auto value = static_cast<uint64_t>(value_id & _mask);
+  const auto bit_offset = static_cast<uint64_t>(index) * _bit_width;
+  const auto word_index = bit_offset / 64;
+  const auto shift = bit_offset % 64;
+
+  auto* words = _words.mutable_data();
+  words[word_index] = (words[word_index] & ~(uint64_t{_mask} << shift)) | (value << shift);
+  if (shift + _bit_width > 64) {
+    const auto spilled_bits = 64 - shift;
+    words[word_index + 1] = (words[word_index + 1] & ~(uint64_t{_mask} >> spilled_bits)) | (value >> spilled_bits);
+  }
+}
+
+void BitPackedVector::decode_range(const size_t begin, const size_t end, std::vector<ValueID>& output) const {
+  Assert(begin <= end && end <= _size, "Invalid range given.");
+  output.resize(end - begin);
+  auto* output_data = output.data();
+  auto index = begin;
+
+#if defined(__AVX2__)
+  // Each value is fetched with an unaligned 32 bit load starting at the byte its first bit lies in. As the value may
+  // start up to seven bits into that byte, this works for bit widths up to 25. The bytes are interpreted in
+  // little-endian order, which matches the layout of our 64 bit words on x86.
+  if (_bit_width <= 25) {
+    const auto* const bytes = reinterpret_cast<const char*>(_words.data());
+    const auto lane_offsets =
+        _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(_bit_width));
+    const auto mask = _mm256_set1_epi32(static_cast<int>(_mask));
+    const auto seven = _mm256_set1_epi32(7);
+
+    for (; index + 8 <= end; index += 8) {
+      const auto base_bit_offset = static_cast<uint64_t>(index) * _bit_width;
+      const auto* const base = reinterpret_cast<const int*>(bytes + base_bit_offset / 8);
+      const auto bit_offsets =
+          _mm256_add_epi32(lane_offsets, _mm256_set1_epi32(static_cast<int>(base_bit_offset % 8)));
+
+      const auto gathered = _mm256_i32gather_epi32(base, _mm256_srli_epi32(bit_offsets, 3), 1);
+      const auto values = _mm256_and_si256(_mm256_srlv_epi32(gathered, _mm256_and_si256(bit_offsets, seven)), mask);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(output_data + (index - begin)), values);
+    }
+  }
+#endif
+
+  _decode_range_scalar(index, end, output_data + (index - begin));
+}
+
+void BitPackedVector::_decode_range_scalar(const size_t begin, const size_t end, ValueID* output) const {
+  // Instead of recomputing the word position for every value, we keep a running offset into the packed words.
+  auto bit_offset = static_cast<uint64_t>(begin) * _bit_width;
+  for (auto index = begin; index < end; ++index, bit_offset += _bit_width) {
+    const auto word_index = bit_offset / 64;
+    const auto shift = bit_offset % 64;
+    auto value = _words[word_index] >> shift;
+    if (shift + _bit_width > 64) {
+      value |= _words[word_index + 1] << (64 - shift);
+    }
+    *output++ = ValueID{static_cast<uint32_t>(value & _mask)};
+  }
+}
+
+size_t BitPackedVector::size() const {
+  return _size;
+}
+
+AttributeVectorWidth BitPackedVector::width() const {
+  return static_cast<AttributeVectorWidth>((_bit_width + 7) / 8);
+}
+
+uint8_t BitPackedVector::bit_width() const {
+  return _bit_width;
+}
+
+const Buffer<uint64_t>& BitPackedVector::words() const {
+  return _words;
+}
+
+size_t BitPackedVector::estimate_memory_usage() const {
+  return _words.estimate_memory_usage();
+}
+
+uint8_t BitPackedVector::required_bit_width(const uint32_t max_value_id) {
+  return static_cast<uint8_t>(std::max(static_cast<int>(std::bit_width(max_value_id)), 1));
+}
+
+}  // namespace opossum
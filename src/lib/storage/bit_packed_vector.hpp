@@ -0,0 +1,60 @@
+#pragma once
+
+#include "abstract_attribute_vector.hpp"
+#include "buffer.hpp"
+
+namespace opossum {
+
+// BitPackedVector implements an attribute vector that stores every value id with the minimal number of bits (1-32)
+// needed for the largest value id. Values are laid out back-to-back, starting at the least significant bit of 64 bit
+// words. As with FixedWidthIntegerVector, NULL_VALUE_ID is truncated to the largest value representable with the bit
+// width (i.e., all bits set), so the bit width has to be chosen such that this value is not a valid value id.
+class BitPackedVector : public AbstractAttributeVector {
+ public:
+  // Creates the vector from a normal std::vector, packing each value id with the given number of bits.
+  BitPackedVector(const std::vector<ValueID>& values, const uint8_t bit_width);
+
+  // Creates the vector from words that are already packed (see words()), e.g., when loading it from a file. They may
+  // live in a mapped file.
+  BitPackedVector(Buffer<uint64_t>&& words, const size_t size, const uint8_t bit_width);
+
+  // Returns the value id at a given position.
+  ValueID get(const size_t index) const override;
+
+  // Sets the value id at a given position.
+  void set(const size_t index, const ValueID value_id) override;
+
+  // Writes the value ids in [begin, end) to the given output vector. If the library is compiled with AVX2 support,
+  // eight values are unpacked at once.
+  void decode_range(const size_t begin, const size_t end, std::vector<ValueID>& output) const override;
+
+  // Returns the number of values.
+  size_t size() const override;
+
+  // Returns the width of biggest value id in bytes, rounded up to whole bytes.
+  AttributeVectorWidth width() const override;
+
+  // Returns the number of bits used to store every value id.
+  uint8_t bit_width() const;
+
+  // Returns the packed words, including the additional zeroed word at the end.
+  const Buffer<uint64_t>& words() const;
+
+  // Returns the calculated memory usage of the packed words.
+  size_t estimate_memory_usage() const override;
+
+  // Returns the smallest bit width that can represent all value ids in [0, max_value_id].
+  static uint8_t required_bit_width(const uint32_t max_value_id);
+
+ protected:
+  // Holds the packed values plus one additional zeroed word, so that we can always read the word following the one
+  // a value starts in (and unaligned 4 byte loads near the end do not touch memory we do not own).
+  Buffer<uint64_t> _words;
+  size_t _size;
+  uint8_t _bit_width;
+  uint32_t _mask;
+
+  void _decode_range_scalar(const size_t begin, const size_t end, ValueID* output) const;
+};
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Buffer is a contiguous array of trivially copyable values that is either owned, i.e., held in a std::vector, or lives
+// in external memory, e.g., a memory-mapped file. In the latter case, the buffer keeps the owner of the memory alive
+// through a lifetime handle, as ExternalSegment does. Encoded segments store their dictionaries and attribute vectors
+// in Buffers, so that they can be used directly from a mapped file, which the operating system pages in on first
+// access. Apart from construction, external buffers are read-only.
+template <typename T>
+class Buffer {
+  static_assert(std::is_trivially_copyable_v<T>, "Buffers are only supported for trivially copyable types.");
+
+ public:
+  using value_type = T;
+
+  Buffer() = default;
+
+  explicit Buffer(std::vector<T>&& values) : _owned_values(std::move(values)), _values(_owned_values) {}
+
+  // Wraps values, which need to stay valid and unchanged as long as owner is alive.
+  Buffer(const std::span<const T> values, const std::shared_ptr<const void>& owner) : _values(values), _owner(owner) {}
+
+  Buffer(const Buffer& other) {
+    *this = other;
+  }
+
+  Buffer(Buffer&& other) noexcept {
+    *this = std::move(other);
+  }
+
+  Buffer& operator=(const Buffer& other) {
+    if (this != &other) {
+      _owned_values = other._owned_values;
+      _owner = other._owner;
+      _values = other.is_external() ? other._values : std::span<const T>{_owned_values};
+    }
+    return *this;
+  }
+
+  Buffer& operator=(Buffer&& other) noexcept {
+    if (this != &other) {
+      // Moving a std::vector keeps its elements in place, so the view stays valid.
+      _owned_values = std::move(other._owned_values);
+      _owner = std::move(other._owner);
+      _values = std::exchange(other._values, {});
+    }
+    return *this;
+  }
+
+  const T& operator[](const size_t index) const {
+    return _values[index];
+  }
+
+  const T* data() const {
+    return _values.data();
+  }
+
+  // Returns a pointer for modifying the values. Only owned buffers can be modified.
+  T* mutable_data() {
+    Assert(!is_external(), "External buffers are read-only.");
+    return _owned_values.data();
+  }
+
+  const T* begin() const {
+    return _values.data();
+  }
+
+  const T* end() const {
+    return _values.data() + _values.size();
+  }
+
+  const T& front() const {
+    return _values.front();
+  }
+
+  const T& back() const {
+    return _values.back();
+  }
+
+  size_t size() const {
+    return _values.size();
+  }
+
+  bool empty() const {
+    return _values.empty();
+  }
+
+  std::span<const T> span() const {
+    return _values;
+  }
+
+  // Returns whether the values live in external memory.
+  bool is_external() const {
+    return _owner != nullptr;
+  }
+
+  // Returns the handle that keeps external memory alive, or nullptr for owned buffers.
+  const std::shared_ptr<const void>& owner() const {
+    return _owner;
+  }
+
+  // Returns the size of the values in bytes. For external buffers, this memory is shared with the owner and, for
+  // mapped files, only resident once it has been accessed.
+  size_t estimate_memory_usage() const {
+    return _values.size_bytes();
+  }
+
+  bool operator==(const Buffer& other) const {
+    return std::equal(begin(), end(), other.begin(), other.end());
+  }
+
+ protected:
+  std::vector<T> _owned_values;
+  std::span<const T> _values;
+  std::shared_ptr<const void> _owner;
+};
+
+}  // namespace opossum
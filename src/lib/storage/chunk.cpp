@@ -2,6 +2,8 @@
 #include <boost/hana/for_each.hpp>
 
 #include "abstract_segment.hpp"
+#include "column_values.hpp"
+#include "statistics/segment_statistics.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
 
@@ -37,10 +39,43 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   }
 }
 
+void Chunk::append_columns(const std::vector<std::shared_ptr<const AbstractColumnValues>>& columns, const size_t begin,
+                           const size_t end) {
+  Assert(columns.size() == _segments.size(), "Number of columns and number of segments should be equal.");
+  Assert(size() + (end - begin) <= std::numeric_limits<ChunkOffset>::max(), "Chunk size limit is exceeded.");
+
+  for (auto segment_index = size_t{0}; segment_index < _segments.size(); ++segment_index) {
+    auto append_successful = false;
+    hana::for_each(opossum::types, [&](auto opossum_type) {
+      using Type = typename decltype(opossum_type)::type;
+      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<Type>>(_segments[segment_index]);
+      const auto column_values = std::dynamic_pointer_cast<const ColumnValues<Type>>(columns[segment_index]);
+      if (!append_successful && value_segment && column_values) {
+        value_segment->append(*column_values, begin, end);
+        append_successful = true;
+      }
+    });
+    Assert(append_successful, "Either some segment of the chunk is not a ValueSegment or the column types differ.");
+  }
+}
+
 std::shared_ptr<AbstractSegment> Chunk::get_segment(const ColumnID column_id) const {
   return _segments.at(column_id);
 }
 
+void Chunk::set_segment_statistics(
+    const std::vector<std::shared_ptr<const AbstractSegmentStatistics>>& statistics) {
+  Assert(statistics.size() == _segments.size(), "Number of statistics and number of columns should be equal.");
+  _segment_statistics = statistics;
+}
+
+std::shared_ptr<const AbstractSegmentStatistics> Chunk::get_segment_statistics(const ColumnID column_id) const {
+  if (_segment_statistics.empty()) {
+    return nullptr;
+  }
+  return _segment_statistics.at(column_id);
+}
+
 ColumnCount Chunk::column_count() const {
   // Narrowing conversion is ok because we make sure to never have as many columns that the value overflows.
   return static_cast<ColumnCount>(_segments.size());
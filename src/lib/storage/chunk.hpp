@@ -8,7 +8,9 @@
 namespace opossum {
 
 class BaseIndex;
+class AbstractColumnValues;
 class AbstractSegment;
+class AbstractSegmentStatistics;
 
 // A chunk is a horizontal partition of a table. For each column in the table, it holds one segment. The segments
 // across all chunks constitute the column.
@@ -32,11 +34,25 @@ class Chunk : private Noncopyable {
   // for testing purposes only.
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Adds the rows [begin, end) of the given columns, which need to match the types of the segments. The type of each
+  // segment is resolved once instead of once per value, so this is much faster than append().
+  void append_columns(const std::vector<std::shared_ptr<const AbstractColumnValues>>& columns, const size_t begin,
+                      const size_t end);
+
   // Returns the segment at a given position.
   std::shared_ptr<AbstractSegment> get_segment(ColumnID column_id) const;
 
+  // Sets the statistics of all segments. They are computed when a chunk is compressed and must not change afterwards,
+  // as operators may read them concurrently.
+  void set_segment_statistics(const std::vector<std::shared_ptr<const AbstractSegmentStatistics>>& statistics);
+
+  // Returns the statistics of the segment at a given position, or nullptr if the chunk has no statistics (e.g.,
+  // because it has not been compressed).
+  std::shared_ptr<const AbstractSegmentStatistics> get_segment_statistics(ColumnID column_id) const;
+
  protected:
   std::vector<std::shared_ptr<AbstractSegment>> _segments;
+  std::vector<std::shared_ptr<const AbstractSegmentStatistics>> _segment_statistics;
 };
 
 }  // namespace opossum
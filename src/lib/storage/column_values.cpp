@@ -0,0 +1,35 @@
+#include "column_values.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+ColumnValues<T>::ColumnValues(std::vector<T>&& values, std::optional<NullBitmap>&& nulls)
+    : _values(std::move(values)), _nulls(std::move(nulls)) {
+  Assert(!_nulls || _nulls->size() == _values.size(), "NULL bitmap needs to have one bit per value.");
+}
+
+template <typename T>
+size_t ColumnValues<T>::size() const {
+  return _values.size();
+}
+
+template <typename T>
+bool ColumnValues<T>::contains_null(const size_t begin, const size_t end) const {
+  return _nulls && _nulls->find_next_set(begin) < end;
+}
+
+template <typename T>
+const std::vector<T>& ColumnValues<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const std::optional<NullBitmap>& ColumnValues<T>::nulls() const {
+  return _nulls;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnValues);
+
+}  // namespace opossum
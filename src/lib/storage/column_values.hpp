@@ -0,0 +1,50 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "null_bitmap.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Holds the values of a single column that are appended to a table in bulk (see Table::append_columns()). Unlike rows
+// of AllTypeVariants, the values are kept in a typed vector, so appending them requires neither variant construction
+// nor a cast per value.
+class AbstractColumnValues : private Noncopyable {
+ public:
+  AbstractColumnValues() = default;
+  virtual ~AbstractColumnValues() = default;
+
+  // Returns the number of rows.
+  virtual size_t size() const = 0;
+
+  // Returns whether any of the rows [begin, end) is NULL.
+  virtual bool contains_null(const size_t begin, const size_t end) const = 0;
+};
+
+template <typename T>
+class ColumnValues : public AbstractColumnValues {
+ public:
+  // Creates the column from values. If nulls is given, it needs to have one bit per value, and the values at set bits
+  // are ignored.
+  explicit ColumnValues(std::vector<T>&& values, std::optional<NullBitmap>&& nulls = std::nullopt);
+
+  size_t size() const final;
+
+  bool contains_null(const size_t begin, const size_t end) const final;
+
+  const std::vector<T>& values() const;
+
+  // Returns the NULL bitmap, or std::nullopt if no value is NULL.
+  const std::optional<NullBitmap>& nulls() const;
+
+ protected:
+  const std::vector<T> _values;
+  const std::optional<NullBitmap> _nulls;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(ColumnValues);
+
+}  // namespace opossum
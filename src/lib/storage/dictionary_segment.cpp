@@ -1,67 +1,168 @@
 #include "dictionary_segment.hpp"
 
 #include <algorithm>
+#include <bit>
+#include <numeric>
+#include <string_view>
+#include <unordered_map>
+
 #include "abstract_attribute_vector.hpp"
+#include "bit_packed_vector.hpp"
 #include "fixed_width_integer_vector.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Calls functor with the offset of every non-NULL row of a segment of size rows. The NULL bitmap is read a word of 64
+// rows at a time: words without NULL values are handled without testing any bit, and within the other words, only the
+// non-NULL rows are visited.
+template <typename Functor>
+void for_each_non_null(const NullBitmap* null_values, const ChunkOffset size, const Functor& functor) {
+  if (!null_values) {
+    for (auto offset = ChunkOffset{0}; offset < size; ++offset) {
+      functor(offset);
+    }
+    return;
+  }
+
+  const auto& null_words = null_values->words();
+  for (auto word_index = size_t{0}; word_index < null_words.size(); ++word_index) {
+    const auto word_begin = static_cast<ChunkOffset>(word_index * NullBitmap::BITS_PER_WORD);
+    if (null_words[word_index] == 0) {
+      const auto word_end = std::min(word_begin + static_cast<ChunkOffset>(NullBitmap::BITS_PER_WORD), size);
+      for (auto offset = word_begin; offset < word_end; ++offset) {
+        functor(offset);
+      }
+      continue;
+    }
+    // The padding bits beyond the last row are zero, so the inverted word has to be cut off at the last row.
+    for (auto non_null_bits = ~null_words[word_index]; non_null_bits != 0; non_null_bits &= non_null_bits - 1) {
+      const auto offset = word_begin + static_cast<ChunkOffset>(std::countr_zero(non_null_bits));
+      if (offset >= size) {
+        break;
+      }
+      functor(offset);
+    }
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 template <typename T>
-DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment,
+                                        const VectorCompressionType vector_compression_type,
+                                        const bool compress_string_dictionary) {
   const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
   Assert(value_segment, "Can only construct a DictionarySegment from a value segment of matching type.");
-  _construct_dictionary(value_segment);
-  _construct_attribute_vector(value_segment);
+  const auto value_ids = _construct_dictionary(*value_segment, compress_string_dictionary);
+  _construct_attribute_vector(value_ids, vector_compression_type);
+}
+
+template <typename T>
+DictionarySegment<T>::DictionarySegment(Dictionary&& dictionary,
+                                        const std::shared_ptr<AbstractAttributeVector>& attribute_vector,
+                                        const ValueID null_value_id)
+    : _dictionary(std::move(dictionary)), _attribute_vector(attribute_vector), _null_value_id(null_value_id) {
+  Assert(_attribute_vector, "DictionarySegment needs an attribute vector.");
+  Assert(_attribute_vector->size() <= std::numeric_limits<ChunkOffset>::max(), "Too many values for a single segment.");
+  Assert(_dictionary.size() <= _null_value_id, "NULL value id must not refer to a dictionary entry.");
 }
 
 template <typename T>
-void DictionarySegment<T>::_construct_dictionary(const std::shared_ptr<ValueSegment<T>>& value_segment) {
-  const auto original_values = value_segment->values();
-  const auto num_values = original_values.size();
-  _dictionary.reserve(original_values.size());
+std::vector<ValueID> DictionarySegment<T>::_construct_dictionary(const ValueSegment<T>& value_segment,
+                                                                 const bool compress_string_dictionary) {
+  const auto& values = value_segment.values();
+  const auto num_values = static_cast<ChunkOffset>(values.size());
+  const auto* null_values = value_segment.is_nullable() ? &value_segment.null_values() : nullptr;
   // We need to make sure to only put values in our dictionary that don't correspond to NULL_VALUE.
   // However, we cannot just remove the default value for T (for example, "" for std::string) from our final dictionary,
-  // because somebody might have actually inserted this value without meaning the NULL_VALUE.
-  for (auto offset = ChunkOffset{0}; offset < num_values; ++offset) {
-    if (!value_segment->is_null(offset)) {
-      _dictionary.push_back(original_values[offset]);
+  // because somebody might have actually inserted this value without meaning the NULL_VALUE. Thus, NULL rows are
+  // skipped based on the NULL bitmap and keep NULL_VALUE_ID.
+  auto value_ids = std::vector<ValueID>(num_values, NULL_VALUE_ID);
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Strings are expensive to copy and to compare. Thus, we first assign temporary ids in order of appearance using a
+    // hash map on views into the value segment, and then only sort the (usually far fewer) distinct values.
+    auto temporary_ids = std::unordered_map<std::string_view, ValueID>{};
+    auto distinct_values = std::vector<std::string_view>{};
+    for_each_non_null(null_values, num_values, [&](const ChunkOffset offset) {
+      const auto [entry, inserted] =
+          temporary_ids.try_emplace(values[offset], ValueID{static_cast<uint32_t>(distinct_values.size())});
+      if (inserted) {
+        distinct_values.emplace_back(values[offset]);
+      }
+      value_ids[offset] = entry->second;
+    });
+
+    auto sorted_temporary_ids = std::vector<ValueID>(distinct_values.size());
+    std::iota(sorted_temporary_ids.begin(), sorted_temporary_ids.end(), ValueID{0});
+    std::sort(sorted_temporary_ids.begin(), sorted_temporary_ids.end(),
+              [&](const auto lhs, const auto rhs) { return distinct_values[lhs] < distinct_values[rhs]; });
+
+    auto final_ids = std::vector<ValueID>(distinct_values.size());
+    auto sorted_values = std::vector<std::string_view>{};
+    sorted_values.reserve(distinct_values.size());
+    for (const auto temporary_id : sorted_temporary_ids) {
+      final_ids[temporary_id] = ValueID{static_cast<uint32_t>(sorted_values.size())};
+      sorted_values.emplace_back(distinct_values[temporary_id]);
+    }
+    _dictionary = StringDictionary{sorted_values, compress_string_dictionary};
+
+    for_each_non_null(null_values, num_values,
+                      [&](const ChunkOffset offset) { value_ids[offset] = final_ids[value_ids[offset]]; });
+  } else {
+    // Numeric values are cheap to copy, so we sort them together with their original offsets. Walking the sorted
+    // sequence then yields both the dictionary and the ValueID of every row.
+    auto values_with_offsets = std::vector<std::pair<T, ChunkOffset>>{};
+    values_with_offsets.reserve(num_values);
+    for_each_non_null(null_values, num_values,
+                      [&](const ChunkOffset offset) { values_with_offsets.emplace_back(values[offset], offset); });
+    std::sort(values_with_offsets.begin(), values_with_offsets.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    auto dictionary = std::vector<T>{};
+    for (const auto& [value, offset] : values_with_offsets) {
+      if (dictionary.empty() || dictionary.back() < value) {
+        dictionary.emplace_back(value);
+      }
+      value_ids[offset] = ValueID{static_cast<uint32_t>(dictionary.size() - 1)};
     }
+    dictionary.shrink_to_fit();
+    _dictionary = Buffer<T>{std::move(dictionary)};
   }
 
-  std::sort(_dictionary.begin(), _dictionary.end());
-  _dictionary.erase(std::unique(_dictionary.begin(), _dictionary.end()), _dictionary.end());
-  _dictionary.shrink_to_fit();
+  return value_ids;
 }
 
 template <typename T>
-void DictionarySegment<T>::_construct_attribute_vector(const std::shared_ptr<ValueSegment<T>>& value_segment) {
-  const auto original_values = value_segment->values();
-  const auto num_values = original_values.size();
-
-  auto value_ids_for_values = std::vector<ValueID>{};
-  value_ids_for_values.reserve(num_values);
-  for (auto offset = ChunkOffset{0}; offset < num_values; ++offset) {
-    if (value_segment->is_null(offset)) {
-      value_ids_for_values.push_back(NULL_VALUE_ID);
-    } else {
-      value_ids_for_values.push_back(_value_id_for_value(original_values[offset]));
-    }
+void DictionarySegment<T>::_construct_attribute_vector(const std::vector<ValueID>& value_ids,
+                                                       const VectorCompressionType vector_compression_type) {
+  // When bit-packing, the largest ValueID that is representable with the chosen bit width serves as NULL value id.
+  // Thus, we need one bit pattern more than we have dictionary entries.
+  if (vector_compression_type == VectorCompressionType::BitPacked) {
+    const auto bit_width = BitPackedVector::required_bit_width(static_cast<uint32_t>(_dictionary.size()));
+    _attribute_vector = std::make_shared<BitPackedVector>(value_ids, bit_width);
+    _null_value_id = ValueID{static_cast<uint32_t>((uint64_t{1} << bit_width) - 1)};
+    return;
   }
 
   // Selecting the appropriate datatype for our attribute vector depending on how many distinct values we have.
   // We need to use size() + 1 here because we need to be able to distinguish any valid ValueID from our
   // _null_value_id.
   if (_dictionary.size() + 1 > std::numeric_limits<uint16_t>::max()) {
-    _attribute_vector = std::make_shared<FixedWidthIntegerVector<uint32_t>>(value_ids_for_values);
+    _attribute_vector = std::make_shared<FixedWidthIntegerVector<uint32_t>>(value_ids);
     _null_value_id = NULL_VALUE_ID;
   } else if (_dictionary.size() + 1 > std::numeric_limits<uint8_t>::max()) {
-    _attribute_vector = std::make_shared<FixedWidthIntegerVector<uint16_t>>(value_ids_for_values);
+    _attribute_vector = std::make_shared<FixedWidthIntegerVector<uint16_t>>(value_ids);
     _null_value_id = static_cast<uint16_t>(NULL_VALUE_ID);
   } else {
-    _attribute_vector = std::make_shared<FixedWidthIntegerVector<uint8_t>>(value_ids_for_values);
+    _attribute_vector = std::make_shared<FixedWidthIntegerVector<uint8_t>>(value_ids);
     _null_value_id = static_cast<uint8_t>(NULL_VALUE_ID);
   }
 }
@@ -92,7 +193,7 @@ std::optional<T> DictionarySegment<T>::get_typed_value(const ChunkOffset chunk_o
 }
 
 template <typename T>
-const std::vector<T>& DictionarySegment<T>::dictionary() const {
+const typename DictionarySegment<T>::Dictionary& DictionarySegment<T>::dictionary() const {
   return _dictionary;
 }
 
@@ -109,28 +210,26 @@ ValueID DictionarySegment<T>::null_value_id() const {
 template <typename T>
 const T DictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
   Assert(value_id < _dictionary.size(), "Given value ID is not contained in the dictionary.");
-  return _dictionary[value_id];
-}
-
-template <typename T>
-ValueID DictionarySegment<T>::_value_id_for_value(const T value) const {
-  const auto index = find(_dictionary.begin(), _dictionary.end(), value);
-  // Note that by returning, e.g., INVALID_VALUE_ID, we could use this method to check whether the value is
-  // actually contained in the dictionary.
-  // However, this method is only used internally during construction of the segment.
-  // Therefore, every value we query here should be contained in the dictionary.
-  // In order to avoid having to check the return value of this method, we decided to use an assertion here.
-  Assert(index != _dictionary.end(), "Value is not contained in dictionary.");
-  return static_cast<ValueID>(std::distance(_dictionary.begin(), index));
+  if constexpr (std::is_same_v<T, std::string>) {
+    return _dictionary.get(value_id);
+  } else {
+    return _dictionary[value_id];
+  }
 }
 
 template <typename T>
 ValueID DictionarySegment<T>::lower_bound(const T value) const {
-  const auto lower_bound_position = std::lower_bound(_dictionary.begin(), _dictionary.end(), value);
-  if (lower_bound_position == _dictionary.end()) {
+  auto lower_bound_index = size_t{0};
+  if constexpr (std::is_same_v<T, std::string>) {
+    lower_bound_index = _dictionary.lower_bound(value);
+  } else {
+    const auto position = std::lower_bound(_dictionary.begin(), _dictionary.end(), value);
+    lower_bound_index = static_cast<size_t>(std::distance(_dictionary.begin(), position));
+  }
+  if (lower_bound_index == _dictionary.size()) {
     return INVALID_VALUE_ID;
   }
-  return static_cast<ValueID>(std::distance(_dictionary.begin(), lower_bound_position));
+  return static_cast<ValueID>(lower_bound_index);
 }
 
 template <typename T>
@@ -140,11 +239,17 @@ ValueID DictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
 
 template <typename T>
 ValueID DictionarySegment<T>::upper_bound(const T value) const {
-  const auto upper_bound_position = std::upper_bound(_dictionary.begin(), _dictionary.end(), value);
-  if (upper_bound_position == _dictionary.end()) {
+  auto upper_bound_index = size_t{0};
+  if constexpr (std::is_same_v<T, std::string>) {
+    upper_bound_index = _dictionary.upper_bound(value);
+  } else {
+    const auto position = std::upper_bound(_dictionary.begin(), _dictionary.end(), value);
+    upper_bound_index = static_cast<size_t>(std::distance(_dictionary.begin(), position));
+  }
+  if (upper_bound_index == _dictionary.size()) {
     return INVALID_VALUE_ID;
   }
-  return static_cast<ValueID>(std::distance(_dictionary.begin(), upper_bound_position));
+  return static_cast<ValueID>(upper_bound_index);
 }
 
 template <typename T>
@@ -164,7 +269,7 @@ ChunkOffset DictionarySegment<T>::size() const {
 
 template <typename T>
 size_t DictionarySegment<T>::estimate_memory_usage() const {
-  return _attribute_vector->width() * _attribute_vector->size() + sizeof(T) * _dictionary.capacity();
+  return _attribute_vector->estimate_memory_usage() + _dictionary.estimate_memory_usage();
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(DictionarySegment);
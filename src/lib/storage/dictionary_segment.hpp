@@ -1,6 +1,7 @@
 #pragma once
 
 #include "abstract_segment.hpp"
+#include "string_dictionary.hpp"
 #include "value_segment.hpp"
 
 namespace opossum {
@@ -13,10 +14,25 @@ constexpr ValueID NULL_VALUE_ID{INVALID_VALUE_ID};
 template <typename T>
 class DictionarySegment : public AbstractSegment {
  public:
+  // Strings are stored in a contiguous StringDictionary, all other types in a plain Buffer.
+  using Dictionary = std::conditional_t<std::is_same_v<T, std::string>, StringDictionary, Buffer<T>>;
+
   /**
-   * Creates a Dictionary segment from a given value segment.
+   * Creates a Dictionary segment from a given value segment. The vector compression type determines whether the value
+   * ids are stored with a byte-aligned width (fast access) or bit-packed with the minimal width (less memory). For
+   * strings, compress_string_dictionary additionally compresses the dictionary entries with an FSSTSymbolTable. It is
+   * ignored for all other types.
    */
-  explicit DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+  explicit DictionarySegment(
+      const std::shared_ptr<AbstractSegment>& abstract_segment,
+      const VectorCompressionType vector_compression_type = VectorCompressionType::FixedWidthInteger,
+      const bool compress_string_dictionary = false);
+
+  // Adopts a sorted dictionary and an attribute vector that refers to it, e.g., when loading the segment from a file.
+  // Both may live in a mapped file, in which case they are only paged in when they are accessed. null_value_id is the
+  // value id that marks NULL rows in the attribute vector (see null_value_id()).
+  DictionarySegment(Dictionary&& dictionary, const std::shared_ptr<AbstractAttributeVector>& attribute_vector,
+                    const ValueID null_value_id);
 
   // Returns the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
@@ -28,7 +44,7 @@ class DictionarySegment : public AbstractSegment {
   std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
 
   // Returns an underlying dictionary.
-  const std::vector<T>& dictionary() const;
+  const Dictionary& dictionary() const;
 
   // Returns an underlying data structure.
   std::shared_ptr<const AbstractAttributeVector> attribute_vector() const;
@@ -63,14 +79,15 @@ class DictionarySegment : public AbstractSegment {
   size_t estimate_memory_usage() const final;
 
  protected:
-  std::vector<T> _dictionary;
+  Dictionary _dictionary;
   std::shared_ptr<AbstractAttributeVector> _attribute_vector;
   ValueID _null_value_id;
 
-  // Returns the ValueID representing a certain value.
-  ValueID _value_id_for_value(const T value) const;
-  void _construct_dictionary(const std::shared_ptr<ValueSegment<T>>& value_segment);
-  void _construct_attribute_vector(const std::shared_ptr<ValueSegment<T>>& value_segment);
+  // Builds the sorted dictionary and returns the ValueID of every row (NULL_VALUE_ID for NULL rows) in one pass.
+  std::vector<ValueID> _construct_dictionary(const ValueSegment<T>& value_segment,
+                                             const bool compress_string_dictionary);
+  void _construct_attribute_vector(const std::vector<ValueID>& value_ids,
+                                   const VectorCompressionType vector_compression_type);
 };
 
 EXPLICITLY_DECLARE_DATA_TYPES(DictionarySegment);
@@ -0,0 +1,90 @@
+#include "external_segment.hpp"
+
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+ExternalSegment<T>::ExternalSegment(const std::span<const T> values, const std::shared_ptr<const void>& owner,
+                                    std::optional<NullBitmap>&& null_values)
+    : _values(values), _owner(owner), _null_values(std::move(null_values)) {
+  Assert(_values.size() <= std::numeric_limits<ChunkOffset>::max(), "Too many values for a single segment.");
+  Assert(!_null_values || _null_values->size() == _values.size(), "NULL bitmap needs to have one bit per value.");
+}
+
+template <typename T>
+AllTypeVariant ExternalSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  if (is_null(chunk_offset)) {
+    return NULL_VALUE;
+  }
+
+  return _values[chunk_offset];
+}
+
+template <typename T>
+bool ExternalSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Invalid chunk offset given.");
+  return _null_values.has_value() && (*_null_values)[chunk_offset];
+}
+
+template <typename T>
+T ExternalSegment<T>::get(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Invalid chunk offset given.");
+  Assert(!is_null(chunk_offset), "No value present at offset.");
+  return _values[chunk_offset];
+}
+
+template <typename T>
+std::optional<T> ExternalSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  return get(chunk_offset);
+}
+
+template <typename T>
+std::span<const T> ExternalSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+bool ExternalSegment<T>::is_nullable() const {
+  return _null_values.has_value();
+}
+
+template <typename T>
+const NullBitmap& ExternalSegment<T>::null_values() const {
+  Assert(is_nullable(), "Can only get null_values for segment supporting them.");
+  return *_null_values;
+}
+
+template <typename T>
+const std::shared_ptr<const void>& ExternalSegment<T>::owner() const {
+  return _owner;
+}
+
+template <typename T>
+std::shared_ptr<ValueSegment<T>> ExternalSegment<T>::to_value_segment() const {
+  auto null_values = _null_values;
+  return std::make_shared<ValueSegment<T>>(std::vector<T>(_values.begin(), _values.end()), std::move(null_values));
+}
+
+template <typename T>
+ChunkOffset ExternalSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_values.size());
+}
+
+template <typename T>
+size_t ExternalSegment<T>::estimate_memory_usage() const {
+  const auto null_values_size = is_nullable() ? _null_values->estimate_memory_usage() : size_t{0};
+  return sizeof(T) * _values.size() + null_values_size;
+}
+
+template class ExternalSegment<int32_t>;
+template class ExternalSegment<int64_t>;
+template class ExternalSegment<float>;
+template class ExternalSegment<double>;
+
+}  // namespace opossum
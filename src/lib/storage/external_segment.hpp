@@ -0,0 +1,72 @@
+#pragma once
+
+#include <span>
+
+#include "abstract_segment.hpp"
+#include "null_bitmap.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueSegment;
+
+// ExternalSegment is a read-only segment type for fixed-width columns whose values live in a contiguous buffer that is
+// not owned by the segment, e.g., a batch produced by a loader or a memory-mapped file. The segment keeps the owner of
+// the buffer alive through a lifetime handle, so wrapping a buffer takes constant time and copies no values. Apart from
+// not being appendable, it behaves like a ValueSegment.
+template <typename T>
+class ExternalSegment : public AbstractSegment {
+  static_assert(std::is_arithmetic_v<T>, "External segments are only supported for fixed-width types.");
+
+ public:
+  // Wraps values, which need to stay valid and unchanged as long as owner is alive. If null_values is given, it needs
+  // to have one bit per value, and the values at set bits are ignored.
+  ExternalSegment(const std::span<const T> values, const std::shared_ptr<const void>& owner,
+                  std::optional<NullBitmap>&& null_values = std::nullopt);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // Returns whether a value is NULL. The chunk offset is only checked in debug builds.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns all values. As for ValueSegment, this is the preferred way to access the values in operators.
+  std::span<const T> values() const;
+
+  // Returns whether segment supports NULL values.
+  bool is_nullable() const;
+
+  // Returns NULL value bitmap that indicates whether a value is NULL with a set bit at position i. Throws an exception
+  // if is_nullable() returns false.
+  const NullBitmap& null_values() const;
+
+  // Returns the handle that keeps the buffer alive.
+  const std::shared_ptr<const void>& owner() const;
+
+  // Copies the values into a new ValueSegment, e.g., for encoding them.
+  std::shared_ptr<ValueSegment<T>> to_value_segment() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const final;
+
+  // Returns the calculated memory usage of the buffer, which is shared with its owner, and the NULL bitmap.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  const std::span<const T> _values;
+  const std::shared_ptr<const void> _owner;
+  const std::optional<NullBitmap> _null_values;
+};
+
+extern template class ExternalSegment<int32_t>;
+extern template class ExternalSegment<int64_t>;
+extern template class ExternalSegment<float>;
+extern template class ExternalSegment<double>;
+
+}  // namespace opossum
@@ -1,18 +1,26 @@
 #include "fixed_width_integer_vector.hpp"
+
+#include <algorithm>
+
 #include "dictionary_segment.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 template <typename uintX_t>
 FixedWidthIntegerVector<uintX_t>::FixedWidthIntegerVector(const std::vector<ValueID>& values) {
-  _values.reserve(values.size());
+  auto narrowed_values = std::vector<uintX_t>{};
+  narrowed_values.reserve(values.size());
   for (const auto value : values) {
     Assert(value == NULL_VALUE_ID || value <= std::numeric_limits<uintX_t>::max(),
            "Passed value " + std::to_string(value) + " is too big to fit into uint*_t data type of our vector.");
-    _values.push_back(static_cast<uintX_t>(value));
+    narrowed_values.push_back(static_cast<uintX_t>(value));
   }
+  _values = Buffer<uintX_t>{std::move(narrowed_values)};
 }
 
+template <typename uintX_t>
+FixedWidthIntegerVector<uintX_t>::FixedWidthIntegerVector(Buffer<uintX_t>&& values) : _values(std::move(values)) {}
+
 template <typename uintX_t>
 ValueID FixedWidthIntegerVector<uintX_t>::get(const size_t index) const {
   Assert(index < _values.size(), "Invalid index given.");
@@ -24,7 +32,17 @@ void FixedWidthIntegerVector<uintX_t>::set(const size_t index, const ValueID val
   Assert(index < _values.size(), "Index out of bounds for vector and size of vector is fixed (may not be increased).");
   Assert(value_id == NULL_VALUE_ID || value_id <= std::numeric_limits<uintX_t>::max(),
          "Passed value " + std::to_string(value_id) + " is too big to fit into uint*_t data type of our vector.");
-  _values[index] = static_cast<uintX_t>(value_id);
+  _values.mutable_data()[index] = static_cast<uintX_t>(value_id);
+}
+
+template <typename uintX_t>
+void FixedWidthIntegerVector<uintX_t>::decode_range(const size_t begin, const size_t end,
+                                                     std::vector<ValueID>& output) const {
+  Assert(begin <= end && end <= _values.size(), "Invalid range given.");
+  output.resize(end - begin);
+  // ValueID only wraps a uint32_t, so this boils down to a plain widening copy.
+  std::transform(_values.begin() + begin, _values.begin() + end, output.begin(),
+                 [](const auto value) { return ValueID{value}; });
 }
 
 template <typename uintX_t>
@@ -32,11 +50,21 @@ size_t FixedWidthIntegerVector<uintX_t>::size() const {
   return _values.size();
 }
 
+template <typename uintX_t>
+const Buffer<uintX_t>& FixedWidthIntegerVector<uintX_t>::values() const {
+  return _values;
+}
+
 template <typename uintX_t>
 AttributeVectorWidth FixedWidthIntegerVector<uintX_t>::width() const {
   return sizeof(uintX_t);
 }
 
+template <typename uintX_t>
+size_t FixedWidthIntegerVector<uintX_t>::estimate_memory_usage() const {
+  return _values.estimate_memory_usage();
+}
+
 template class FixedWidthIntegerVector<uint32_t>;
 template class FixedWidthIntegerVector<uint16_t>;
 template class FixedWidthIntegerVector<uint8_t>;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "abstract_attribute_vector.hpp"
+#include "buffer.hpp"
 
 namespace opossum {
 
@@ -12,20 +13,32 @@ class FixedWidthIntegerVector : public AbstractAttributeVector {
   // new value we set.
   explicit FixedWidthIntegerVector(const std::vector<ValueID>& values);
 
+  // Adopts value ids that are already narrowed, e.g., when loading them from a file. They may live in a mapped file.
+  explicit FixedWidthIntegerVector(Buffer<uintX_t>&& values);
+
   // Returns the value id at a given position.
   ValueID get(const size_t index) const override;
 
   // Sets the value id at a given position.
   void set(const size_t index, const ValueID value_id) override;
 
+  // Writes the value ids in [begin, end) to the given output vector.
+  void decode_range(const size_t begin, const size_t end, std::vector<ValueID>& output) const override;
+
   // Returns the number of values.
   size_t size() const override;
 
+  // Returns the stored value ids, e.g., to hand them out without copying.
+  const Buffer<uintX_t>& values() const;
+
   // Returns the width of biggest value id in bytes.
   AttributeVectorWidth width() const override;
 
+  // Returns the calculated memory usage of the stored value ids.
+  size_t estimate_memory_usage() const override;
+
  protected:
-  std::vector<uintX_t> _values;
+  Buffer<uintX_t> _values;
 };
 
 }  // namespace opossum
@@ -0,0 +1,236 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "bit_packed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/comparator.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
+  Assert(value_segment, "Can only construct a FrameOfReferenceSegment from a value segment of matching type.");
+
+  const auto& values = value_segment->values();
+  const auto num_values = static_cast<ChunkOffset>(values.size());
+  if (value_segment->is_nullable()) {
+    _null_values = value_segment->null_values();
+  }
+
+  const auto block_count = (num_values + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_minima.reserve(block_count);
+  auto offsets = std::vector<ValueID>(num_values);
+  auto max_offset = uint32_t{0};
+
+  for (auto block_begin = ChunkOffset{0}; block_begin < num_values; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, num_values);
+
+    // NULL values are only placeholders and must not influence the minimum. Blocks that only contain NULL values get a
+    // minimum of zero.
+    auto minimum = std::optional<T>{};
+    auto maximum = std::optional<T>{};
+    for (auto offset = block_begin; offset < block_end; ++offset) {
+      if (!is_nullable() || !(*_null_values)[offset]) {
+        minimum = minimum ? std::min(*minimum, values[offset]) : values[offset];
+        maximum = maximum ? std::max(*maximum, values[offset]) : values[offset];
+      }
+    }
+    _block_minima.emplace_back(minimum.value_or(T{0}));
+
+    // Subtracting in the unsigned domain yields the exact distance, as no value is smaller than the minimum.
+    const auto distance_from_minimum = [&](const T value) {
+      return static_cast<uint64_t>(static_cast<UnsignedT>(value) - static_cast<UnsignedT>(_block_minima.back()));
+    };
+
+    // Offsets are limited to 32 bits. Blocks that span more keep their plain values, so that a single outlier only
+    // affects its own block.
+    if (maximum && distance_from_minimum(*maximum) > std::numeric_limits<uint32_t>::max()) {
+      _unencoded_blocks.emplace_back(block_begin / BLOCK_SIZE);
+      _unencoded_values.insert(_unencoded_values.end(), values.begin() + block_begin, values.begin() + block_end);
+      continue;
+    }
+
+    for (auto offset = block_begin; offset < block_end; ++offset) {
+      if (is_nullable() && (*_null_values)[offset]) {
+        continue;
+      }
+      const auto distance = static_cast<uint32_t>(distance_from_minimum(values[offset]));
+      offsets[offset] = ValueID{distance};
+      max_offset = std::max(max_offset, distance);
+    }
+  }
+
+  _offsets = std::make_shared<BitPackedVector>(offsets, BitPackedVector::required_bit_width(max_offset));
+}
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(std::vector<T>&& block_minima,
+                                                    const std::shared_ptr<BitPackedVector>& offsets,
+                                                    std::vector<uint32_t>&& unencoded_blocks,
+                                                    std::vector<T>&& unencoded_values,
+                                                    std::optional<NullBitmap>&& null_values)
+    : _block_minima(std::move(block_minima)),
+      _offsets(offsets),
+      _unencoded_blocks(std::move(unencoded_blocks)),
+      _unencoded_values(std::move(unencoded_values)),
+      _null_values(std::move(null_values)) {
+  Assert(_offsets && _offsets->size() <= std::numeric_limits<ChunkOffset>::max(), "Invalid offsets given.");
+  Assert(_block_minima.size() == (_offsets->size() + BLOCK_SIZE - 1) / BLOCK_SIZE, "Every block needs a minimum.");
+  Assert(!_null_values || _null_values->size() == _offsets->size(), "NULL bitmap needs to have one bit per value.");
+  Assert(std::adjacent_find(_unencoded_blocks.begin(), _unencoded_blocks.end(), std::greater_equal<uint32_t>{}) ==
+                 _unencoded_blocks.end() &&
+             (_unencoded_blocks.empty() || _unencoded_blocks.back() < _block_minima.size()),
+         "Unencoded blocks need to be strictly ascending block indices.");
+  // All unencoded blocks but the last block of the segment are full.
+  auto unencoded_value_count = _unencoded_blocks.size() * BLOCK_SIZE;
+  if (!_unencoded_blocks.empty() && _unencoded_blocks.back() == _block_minima.size() - 1) {
+    unencoded_value_count -= _block_minima.size() * BLOCK_SIZE - _offsets->size();
+  }
+  Assert(_unencoded_values.size() == unencoded_value_count, "Unencoded blocks need to hold all of their values.");
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  const auto optional_value = get_typed_value(chunk_offset);
+  if (optional_value) {
+    return optional_value.value();
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional_value = get_typed_value(chunk_offset);
+  Assert(optional_value, "Trying to access data that points to a NULL_VALUE.");
+  return optional_value.value();
+}
+
+template <typename T>
+std::optional<T> FrameOfReferenceSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  Assert(chunk_offset < size(), "Invalid chunk offset given.");
+  if (is_nullable() && (*_null_values)[chunk_offset]) {
+    return std::nullopt;
+  }
+  const auto block_index = chunk_offset / BLOCK_SIZE;
+  if (const auto* block_values = _unencoded_block_values(block_index)) {
+    return block_values[chunk_offset % BLOCK_SIZE];
+  }
+  const auto minimum = _block_minima[block_index];
+  return static_cast<T>(static_cast<UnsignedT>(minimum) + static_cast<UnsignedT>(_offsets->get(chunk_offset)));
+}
+
+template <typename T>
+const std::vector<T>& FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+std::shared_ptr<const BitPackedVector> FrameOfReferenceSegment<T>::offsets() const {
+  return _offsets;
+}
+
+template <typename T>
+const std::vector<uint32_t>& FrameOfReferenceSegment<T>::unencoded_blocks() const {
+  return _unencoded_blocks;
+}
+
+template <typename T>
+const std::vector<T>& FrameOfReferenceSegment<T>::unencoded_values() const {
+  return _unencoded_values;
+}
+
+template <typename T>
+bool FrameOfReferenceSegment<T>::is_nullable() const {
+  return _null_values.has_value();
+}
+
+template <typename T>
+const NullBitmap& FrameOfReferenceSegment<T>::null_values() const {
+  Assert(is_nullable(), "Can only get null_values for segment supporting them.");
+  return _null_values.value();
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::scan(const ScanType scan_type, const T search_value, const ChunkID chunk_id,
+                                      PosList& matches) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto num_values = size();
+  const auto max_offset = (uint64_t{1} << _offsets->bit_width()) - 1;
+  auto block_offsets = std::vector<ValueID>{};
+  auto block_results = std::vector<uint8_t>(BLOCK_SIZE);
+
+  with_comparator(scan_type, [&](auto comparator) {
+    for (auto block_begin = ChunkOffset{0}; block_begin < num_values; block_begin += BLOCK_SIZE) {
+      const auto block_end = std::min(block_begin + BLOCK_SIZE, num_values);
+      const auto block_length = block_end - block_begin;
+      const auto block_index = block_begin / BLOCK_SIZE;
+      const auto minimum = _block_minima[block_index];
+
+      // Blocks that keep their plain values are compared directly. For the others, if the search value lies outside of
+      // [minimum, minimum + max_offset], all values of the block compare the same way to it as the minimum does.
+      // Otherwise, we compare the offsets to the distance of the search value.
+      const auto distance =
+          static_cast<uint64_t>(static_cast<UnsignedT>(search_value) - static_cast<UnsignedT>(minimum));
+      if (const auto* block_values = _unencoded_block_values(block_index)) {
+        for (auto index = ChunkOffset{0}; index < block_length; ++index) {
+          block_results[index] = comparator(block_values[index], search_value);
+        }
+      } else if (search_value < minimum || distance > max_offset) {
+        if (!comparator(minimum, search_value)) {
+          continue;
+        }
+        std::fill_n(block_results.begin(), block_length, uint8_t{1});
+      } else {
+        const auto search_offset = static_cast<uint32_t>(distance);
+        _offsets->decode_range(block_begin, block_end, block_offsets);
+        // This loop works on plain integers without any branches, so the compiler can vectorize it.
+        for (auto index = ChunkOffset{0}; index < block_length; ++index) {
+          block_results[index] = comparator(static_cast<uint32_t>(block_offsets[index]), search_offset);
+        }
+      }
+
+      for (auto index = ChunkOffset{0}; index < block_length; ++index) {
+        const auto chunk_offset = block_begin + index;
+        if (block_results[index] && (!is_nullable() || !(*_null_values)[chunk_offset])) {
+          matches.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    }
+  });
+}
+
+template <typename T>
+ChunkOffset FrameOfReferenceSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_offsets->size());
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  const auto null_values_size = is_nullable() ? _null_values->estimate_memory_usage() : size_t{0};
+  return sizeof(T) * _block_minima.capacity() + _offsets->estimate_memory_usage() + null_values_size +
+         sizeof(uint32_t) * _unencoded_blocks.capacity() + sizeof(T) * _unencoded_values.capacity();
+}
+
+template <typename T>
+const T* FrameOfReferenceSegment<T>::_unencoded_block_values(const size_t block_index) const {
+  // Wide blocks are rare, so a binary search over the few unencoded blocks is cheap.
+  const auto iterator = std::lower_bound(_unencoded_blocks.begin(), _unencoded_blocks.end(), block_index);
+  if (iterator == _unencoded_blocks.end() || *iterator != block_index) {
+    return nullptr;
+  }
+  return _unencoded_values.data() + (iterator - _unencoded_blocks.begin()) * BLOCK_SIZE;
+}
+
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
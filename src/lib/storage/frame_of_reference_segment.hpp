@@ -0,0 +1,87 @@
+#pragma once
+
+#include "abstract_segment.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+class BitPackedVector;
+
+// FrameOfReferenceSegment is a segment type for integral columns whose values are clustered in narrow ranges (e.g.,
+// timestamps or ids). The rows are split into fixed-size blocks. For each block, we store its minimum and for each
+// row, the offset of its value from the minimum of its block. All offsets are bit-packed with the width required for
+// the largest offset. Blocks whose values span more than 32 bits, e.g., a long column with a single outlier, keep their
+// plain values instead and store offsets of zero.
+template <typename T>
+class FrameOfReferenceSegment : public AbstractSegment {
+  static_assert(std::is_integral_v<T>, "Frame-of-reference encoding is only supported for integral types.");
+
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{2048};
+
+  /**
+   * Creates a FrameOfReference segment from a given value segment.
+   */
+  explicit FrameOfReferenceSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Adopts the block minima, offsets, and unencoded blocks of a segment (see block_minima(), offsets(),
+  // unencoded_blocks(), and unencoded_values()), e.g., when loading it from a file. If null_values is given, the
+  // segment is nullable, and the bitmap needs to have one bit per value.
+  FrameOfReferenceSegment(std::vector<T>&& block_minima, const std::shared_ptr<BitPackedVector>& offsets,
+                          std::vector<uint32_t>&& unencoded_blocks, std::vector<T>&& unencoded_values,
+                          std::optional<NullBitmap>&& null_values = std::nullopt);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns the minimum of each block.
+  const std::vector<T>& block_minima() const;
+
+  // Returns the offsets of all rows from the minimum of their block.
+  std::shared_ptr<const BitPackedVector> offsets() const;
+
+  // Returns the ascending indices of the blocks that keep their plain values.
+  const std::vector<uint32_t>& unencoded_blocks() const;
+
+  // Returns the plain values of the blocks in unencoded_blocks(), one block after another.
+  const std::vector<T>& unencoded_values() const;
+
+  // Returns whether segment supports NULL values.
+  bool is_nullable() const;
+
+  // Returns NULL value bitmap that indicates whether a value is NULL with a set bit at position i. Throws an exception
+  // if is_nullable() returns false.
+  const NullBitmap& null_values() const;
+
+  // Appends the positions of all rows that satisfy the predicate "value <scan_type> search_value" to matches. For each
+  // block, the search value is translated into the offset domain once, so that the offsets can be compared without
+  // reconstructing the values. NULL values never match.
+  void scan(const ScanType scan_type, const T search_value, const ChunkID chunk_id, PosList& matches) const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // Returns the plain values of a block, or nullptr if the block stores offsets.
+  const T* _unencoded_block_values(const size_t block_index) const;
+
+  std::vector<T> _block_minima;
+  std::shared_ptr<BitPackedVector> _offsets;
+  std::vector<uint32_t> _unencoded_blocks;
+  std::vector<T> _unencoded_values;
+  std::optional<NullBitmap> _null_values;
+};
+
+extern template class FrameOfReferenceSegment<int32_t>;
+extern template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
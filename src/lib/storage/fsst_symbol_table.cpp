@@ -0,0 +1,159 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// Learning the symbol table on all strings of a large dictionary would be expensive. As in the original FSST paper, a
+// sample of about 16 KB is sufficient to find the frequent symbols.
+constexpr auto SAMPLE_SIZE = size_t{16 * 1024};
+constexpr auto LEARNING_ITERATIONS = 5;
+
+}  // namespace
+
+namespace opossum {
+
+FSSTSymbolTable::FSSTSymbolTable(const std::vector<std::string_view>& values) {
+  auto total_size = size_t{0};
+  for (const auto& value : values) {
+    total_size += value.size();
+  }
+  // Picks evenly distributed values until the sample is large enough.
+  const auto stride = std::max(total_size / SAMPLE_SIZE, size_t{1});
+  auto sample = std::vector<std::string_view>{};
+  for (auto index = size_t{0}; index < values.size(); index += stride) {
+    sample.emplace_back(values[index]);
+  }
+
+  // In each iteration, we encode the sample with the current symbol table and count how many bytes each symbol (and
+  // each concatenation of two adjacent symbols) covers. The symbols covering the most bytes form the next table.
+  for (auto iteration = 0; iteration < LEARNING_ITERATIONS; ++iteration) {
+    auto gains = std::unordered_map<std::string_view, size_t>{};
+    auto concatenations = std::vector<std::string>{};
+    auto concatenation_gains = std::unordered_map<std::string, size_t>{};
+
+    for (const auto& value : sample) {
+      auto previous = std::string_view{};
+      for (auto position = size_t{0}; position < value.size();) {
+        const auto length = _longest_match(value.substr(position)).first;
+        const auto current = value.substr(position, length);
+        gains[current] += length;
+        if (!previous.empty() && previous.size() + length <= MAX_SYMBOL_LENGTH) {
+          // Adjacent symbols are adjacent in the value, so their concatenation is a view into the value as well.
+          concatenation_gains[std::string{previous.data(), previous.size() + length}] += previous.size() + length;
+        }
+        previous = current;
+        position += length;
+      }
+    }
+
+    auto candidates = std::vector<std::pair<size_t, std::string>>{};
+    candidates.reserve(gains.size() + concatenation_gains.size());
+    for (const auto& [symbol, gain] : gains) {
+      candidates.emplace_back(gain, symbol);
+    }
+    for (const auto& [symbol, gain] : concatenation_gains) {
+      if (!gains.contains(symbol)) {
+        candidates.emplace_back(gain, symbol);
+      }
+    }
+    // Ties are broken by the symbol itself, so that learning is deterministic.
+    const auto candidate_count = std::min(candidates.size(), MAX_SYMBOL_COUNT);
+    std::partial_sort(candidates.begin(), candidates.begin() + candidate_count, candidates.end(),
+                      [](const auto& lhs, const auto& rhs) {
+                        return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+                      });
+
+    auto symbols = std::vector<std::string>{};
+    symbols.reserve(candidate_count);
+    for (auto index = size_t{0}; index < candidate_count; ++index) {
+      symbols.emplace_back(std::move(candidates[index].second));
+    }
+    _set_symbols(symbols);
+  }
+}
+
+std::shared_ptr<FSSTSymbolTable> FSSTSymbolTable::from_symbols(const std::vector<std::string>& symbols) {
+  auto symbol_table = std::shared_ptr<FSSTSymbolTable>(new FSSTSymbolTable{});
+  for (const auto& symbol : symbols) {
+    Assert(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH, "Invalid symbol length.");
+  }
+  symbol_table->_set_symbols(symbols);
+  return symbol_table;
+}
+
+void FSSTSymbolTable::_set_symbols(const std::vector<std::string>& symbols) {
+  Assert(symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols given.");
+  _symbol_count = symbols.size();
+  for (auto& codes : _codes_by_first_byte) {
+    codes.clear();
+  }
+
+  for (auto code = size_t{0}; code < _symbol_count; ++code) {
+    const auto& symbol = symbols[code];
+    DebugAssert(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH, "Invalid symbol length.");
+    std::memcpy(_symbols.data() + code * MAX_SYMBOL_LENGTH, symbol.data(), symbol.size());
+    _symbol_lengths[code] = static_cast<uint8_t>(symbol.size());
+    _codes_by_first_byte[static_cast<uint8_t>(symbol[0])].emplace_back(static_cast<uint8_t>(code));
+  }
+
+  for (auto& codes : _codes_by_first_byte) {
+    std::stable_sort(codes.begin(), codes.end(),
+                     [&](const auto lhs, const auto rhs) { return _symbol_lengths[lhs] > _symbol_lengths[rhs]; });
+  }
+}
+
+std::pair<size_t, uint8_t> FSSTSymbolTable::_longest_match(const std::string_view value) const {
+  for (const auto code : _codes_by_first_byte[static_cast<uint8_t>(value[0])]) {
+    const auto length = _symbol_lengths[code];
+    if (length <= value.size() &&
+        std::memcmp(_symbols.data() + code * MAX_SYMBOL_LENGTH, value.data(), length) == 0) {
+      return {length, code};
+    }
+  }
+  return {1, ESCAPE_CODE};
+}
+
+void FSSTSymbolTable::encode(const std::string_view value, std::string& output) const {
+  for (auto position = size_t{0}; position < value.size();) {
+    const auto [length, code] = _longest_match(value.substr(position));
+    output.push_back(static_cast<char>(code));
+    if (code == ESCAPE_CODE) {
+      output.push_back(value[position]);
+    }
+    position += length;
+  }
+}
+
+void FSSTSymbolTable::decode(const std::string_view encoded_value, std::string& output) const {
+  for (auto position = size_t{0}; position < encoded_value.size(); ++position) {
+    const auto code = static_cast<uint8_t>(encoded_value[position]);
+    if (code == ESCAPE_CODE) {
+      ++position;
+      DebugAssert(position < encoded_value.size(), "Escape code at end of encoded value.");
+      output.push_back(encoded_value[position]);
+    } else {
+      DebugAssert(code < _symbol_count, "Unknown code in encoded value.");
+      output.append(_symbols.data() + code * MAX_SYMBOL_LENGTH, _symbol_lengths[code]);
+    }
+  }
+}
+
+size_t FSSTSymbolTable::symbol_count() const {
+  return _symbol_count;
+}
+
+std::string_view FSSTSymbolTable::symbol(const uint8_t code) const {
+  Assert(code < _symbol_count, "Invalid code given.");
+  return std::string_view{_symbols.data() + code * MAX_SYMBOL_LENGTH, _symbol_lengths[code]};
+}
+
+size_t FSSTSymbolTable::estimate_memory_usage() const {
+  return sizeof(_symbols) + sizeof(_symbol_lengths);
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opossum {
+
+// FSSTSymbolTable implements a simplified version of Fast Static Symbol Table (FSST) string compression. A table holds
+// up to 255 symbols of 1 to 8 bytes, which are learned from a sample of the strings to compress. A string is encoded
+// by greedily replacing the longest symbol that matches at the current position with its one byte code. Bytes that no
+// symbol starts with are written as ESCAPE_CODE followed by the byte itself.
+//
+// As the encoding is deterministic, two strings are equal if and only if their encodings are equal. The lexicographic
+// order of strings is not preserved, though.
+class FSSTSymbolTable {
+ public:
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+
+  // Learns a symbol table from the given strings.
+  explicit FSSTSymbolTable(const std::vector<std::string_view>& values);
+
+  // Creates a table from previously learned symbols (see symbol()), e.g., when loading it from a file.
+  static std::shared_ptr<FSSTSymbolTable> from_symbols(const std::vector<std::string>& symbols);
+
+  // Appends the encoding of a string to output.
+  void encode(const std::string_view value, std::string& output) const;
+
+  // Appends the decoded string to output.
+  void decode(const std::string_view encoded_value, std::string& output) const;
+
+  // Returns the number of learned symbols.
+  size_t symbol_count() const;
+
+  // Returns the symbol a code stands for.
+  std::string_view symbol(const uint8_t code) const;
+
+  // Returns the calculated memory usage of the symbols (the lookup structure used for encoding is not included, as it
+  // can be rebuilt from the symbols).
+  size_t estimate_memory_usage() const;
+
+ protected:
+  FSSTSymbolTable() = default;
+
+  // The symbol bytes are stored back-to-back, so that each symbol can be copied with a single (up to) 8 byte copy.
+  std::array<char, MAX_SYMBOL_COUNT * MAX_SYMBOL_LENGTH> _symbols{};
+  std::array<uint8_t, MAX_SYMBOL_COUNT> _symbol_lengths{};
+  size_t _symbol_count{0};
+
+  // For each possible first byte, holds the codes of the symbols starting with it, longest symbols first.
+  std::array<std::vector<uint8_t>, 256> _codes_by_first_byte;
+
+  void _set_symbols(const std::vector<std::string>& symbols);
+
+  // Returns the length of the longest symbol matching at the beginning of value and its code, or {1, ESCAPE_CODE} if
+  // no symbol matches.
+  std::pair<size_t, uint8_t> _longest_match(const std::string_view value) const;
+};
+
+}  // namespace opossum
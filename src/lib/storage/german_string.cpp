@@ -0,0 +1,74 @@
+#include "german_string.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GermanString::GermanString(const std::string_view value) {
+  Assert(value.size() <= std::numeric_limits<uint32_t>::max(), "String exceeds 4 GB.");
+  _length = static_cast<uint32_t>(value.size());
+  if (is_inline()) {
+    // Empty views may have a null data pointer, which memcpy does not accept even for a size of zero.
+    if (!value.empty()) {
+      std::memcpy(_payload, value.data(), value.size());
+    }
+    return;
+  }
+  std::memcpy(_payload, value.data(), PREFIX_LENGTH);
+  const auto* pointer = value.data();
+  std::memcpy(_payload + PREFIX_LENGTH, &pointer, sizeof(pointer));
+}
+
+void GermanStringVector::emplace_back(const std::string_view value) {
+  if (value.size() <= GermanString::INLINE_LENGTH) {
+    _strings.emplace_back(value);
+    return;
+  }
+  auto* characters = _allocate(value.size());
+  std::memcpy(characters, value.data(), value.size());
+  _strings.emplace_back(std::string_view{characters, value.size()});
+}
+
+char* GermanStringVector::_allocate(const size_t size) {
+  if (size > _arena_remaining) {
+    // Strings larger than a block get a block of their own. The rest of the current block is not reused.
+    const auto block_size = std::max(size, std::clamp(_arena_size, MIN_ARENA_BLOCK_SIZE, MAX_ARENA_BLOCK_SIZE));
+    _arena_blocks.emplace_back(std::make_unique_for_overwrite<char[]>(block_size));
+    _arena_position = _arena_blocks.back().get();
+    _arena_remaining = block_size;
+    _arena_size += block_size;
+  }
+  auto* characters = _arena_position;
+  _arena_position += size;
+  _arena_remaining -= size;
+  return characters;
+}
+
+void GermanStringVector::reserve(const size_t size) {
+  _strings.reserve(size);
+}
+
+size_t GermanStringVector::size() const {
+  return _strings.size();
+}
+
+size_t GermanStringVector::capacity() const {
+  return _strings.capacity();
+}
+
+bool GermanStringVector::empty() const {
+  return _strings.empty();
+}
+
+const std::vector<GermanString>& GermanStringVector::german_strings() const {
+  return _strings;
+}
+
+size_t GermanStringVector::estimate_memory_usage() const {
+  return sizeof(GermanString) * _strings.capacity() + _arena_size;
+}
+
+}  // namespace opossum
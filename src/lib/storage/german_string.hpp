@@ -0,0 +1,151 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// GermanString is a 16 byte representation of a string, as introduced by Umbra: a four byte length is followed by
+// twelve bytes of payload. Strings of up to twelve characters are stored inline. For longer strings, the payload holds
+// the first four characters (the prefix) and a pointer to all characters, which are owned by someone else (usually a
+// GermanStringVector). As the length and prefix are always stored inline, most comparisons are decided without
+// following the pointer. Unused payload bytes are zero, so that short strings can be compared word by word.
+class GermanString {
+ public:
+  static constexpr auto INLINE_LENGTH = size_t{12};
+  static constexpr auto PREFIX_LENGTH = size_t{4};
+
+  GermanString() = default;
+
+  // Creates a GermanString for value. If value is longer than INLINE_LENGTH, the GermanString points to the characters
+  // of value, which thus have to outlive it.
+  explicit GermanString(const std::string_view value);
+
+  uint32_t size() const {
+    return _length;
+  }
+
+  bool is_inline() const {
+    return _length <= INLINE_LENGTH;
+  }
+
+  // Returns the characters, which are stored inline for short strings.
+  const char* data() const {
+    if (is_inline()) {
+      return _payload;
+    }
+    auto pointer = static_cast<const char*>(nullptr);
+    std::memcpy(&pointer, _payload + PREFIX_LENGTH, sizeof(pointer));
+    return pointer;
+  }
+
+  std::string_view view() const {
+    return std::string_view{data(), _length};
+  }
+
+  // Checks the length and prefix at once. Only strings of equal length and prefix have to be compared further, which
+  // for short strings are the remaining eight inline bytes.
+  friend bool operator==(const GermanString& lhs, const GermanString& rhs) {
+    if (lhs._head() != rhs._head()) {
+      return false;
+    }
+    if (lhs.is_inline()) {
+      return lhs._tail() == rhs._tail();
+    }
+    return std::memcmp(lhs.data() + PREFIX_LENGTH, rhs.data() + PREFIX_LENGTH, lhs._length - PREFIX_LENGTH) == 0;
+  }
+
+  // Compares the prefixes as big-endian integers first. Since unused prefix bytes are zero, this only decides the order
+  // if the prefixes differ; otherwise, the strings are compared lexicographically.
+  friend std::strong_ordering operator<=>(const GermanString& lhs, const GermanString& rhs) {
+    const auto lhs_prefix = lhs._big_endian_prefix();
+    const auto rhs_prefix = rhs._big_endian_prefix();
+    if (lhs_prefix != rhs_prefix) {
+      return lhs_prefix <=> rhs_prefix;
+    }
+    return lhs.view().compare(rhs.view()) <=> 0;
+  }
+
+ protected:
+  uint32_t _length{0};
+  char _payload[INLINE_LENGTH]{};
+
+  // Returns the length and prefix as a single word.
+  uint64_t _head() const {
+    auto head = uint64_t{0};
+    std::memcpy(&head, this, sizeof(head));
+    return head;
+  }
+
+  // Returns the last eight payload bytes, i.e., the inline suffix or the pointer.
+  uint64_t _tail() const {
+    auto tail = uint64_t{0};
+    std::memcpy(&tail, _payload + PREFIX_LENGTH, sizeof(tail));
+    return tail;
+  }
+
+  uint32_t _big_endian_prefix() const {
+    auto prefix = uint32_t{0};
+    std::memcpy(&prefix, _payload, sizeof(prefix));
+    return __builtin_bswap32(prefix);
+  }
+};
+
+static_assert(sizeof(GermanString) == 16, "GermanString has to fit in 16 bytes.");
+
+// GermanStringVector stores the values of a ValueSegment<std::string> as GermanStrings. The characters of long strings
+// are copied into an arena owned by the vector. The arena consists of blocks that are never moved, so the pointers of
+// the GermanStrings stay valid when the vector grows. Views returned for short strings point into the GermanStrings
+// themselves and are thus invalidated when the vector grows.
+class GermanStringVector {
+ public:
+  // Arena blocks double in size within these bounds, so that small segments do not allocate a large block.
+  static constexpr auto MIN_ARENA_BLOCK_SIZE = size_t{1024};
+  static constexpr auto MAX_ARENA_BLOCK_SIZE = size_t{64 * 1024};
+
+  GermanStringVector() = default;
+  GermanStringVector(const GermanStringVector&) = delete;
+  GermanStringVector& operator=(const GermanStringVector&) = delete;
+  GermanStringVector(GermanStringVector&&) = default;
+  GermanStringVector& operator=(GermanStringVector&&) = default;
+
+  // Returns the string at a given position. This is not bounds-checked.
+  std::string_view operator[](const size_t index) const {
+    return _strings[index].view();
+  }
+
+  // Appends a copy of value. Called without arguments, an empty string is appended, e.g., as placeholder for NULL.
+  void emplace_back(const std::string_view value = {});
+
+  void reserve(const size_t size);
+
+  size_t size() const;
+
+  size_t capacity() const;
+
+  bool empty() const;
+
+  // Returns the GermanStrings, which operators can compare using their prefix-based comparison kernels.
+  const std::vector<GermanString>& german_strings() const;
+
+  // Returns the calculated memory usage of the GermanStrings and the arena.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  std::vector<GermanString> _strings;
+  std::vector<std::unique_ptr<char[]>> _arena_blocks;
+  size_t _arena_size{0};
+  char* _arena_position{nullptr};
+  size_t _arena_remaining{0};
+
+  // Returns a stable buffer for size characters.
+  char* _allocate(const size_t size);
+};
+
+}  // namespace opossum
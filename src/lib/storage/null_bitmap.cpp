@@ -0,0 +1,151 @@
+#include "null_bitmap.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+NullBitmap::NullBitmap(const size_t size, const bool value) {
+  resize(size, value);
+}
+
+NullBitmap::NullBitmap(std::vector<uint64_t>&& words, const size_t size) : _words(std::move(words)), _size(size) {
+  Assert(_words.size() == (size + BITS_PER_WORD - 1) / BITS_PER_WORD, "Number of words does not match the size.");
+  _clear_padding();
+}
+
+void NullBitmap::set(const size_t index, const bool value) {
+  DebugAssert(index < _size, "Invalid index given.");
+  const auto mask = uint64_t{1} << (index % BITS_PER_WORD);
+  auto& word = _words[index / BITS_PER_WORD];
+  word = value ? (word | mask) : (word & ~mask);
+}
+
+void NullBitmap::push_back(const bool value) {
+  if (_size % BITS_PER_WORD == 0) {
+    _words.emplace_back(0);
+  }
+  _words.back() |= static_cast<uint64_t>(value) << (_size % BITS_PER_WORD);
+  ++_size;
+}
+
+void NullBitmap::append(const size_t size, const bool value) {
+  resize(_size + size, value);
+}
+
+void NullBitmap::append(const NullBitmap& other, const size_t begin, const size_t end) {
+  DebugAssert(begin <= end && end <= other._size, "Invalid range given.");
+  reserve(_size + (end - begin));
+  for (auto position = begin; position < end; position += BITS_PER_WORD) {
+    // Assembles the next (up to) 64 bits from one or two words of other ...
+    const auto bit_count = std::min(BITS_PER_WORD, end - position);
+    const auto word_index = position / BITS_PER_WORD;
+    const auto shift = position % BITS_PER_WORD;
+    auto word = other._words[word_index] >> shift;
+    if (shift != 0 && word_index + 1 < other._words.size()) {
+      word |= other._words[word_index + 1] << (BITS_PER_WORD - shift);
+    }
+    if (bit_count < BITS_PER_WORD) {
+      word &= (uint64_t{1} << bit_count) - 1;
+    }
+
+    // ... and distributes them to one or two words of this bitmap.
+    const auto offset = _size % BITS_PER_WORD;
+    if (offset == 0) {
+      _words.emplace_back(word);
+    } else {
+      _words.back() |= word << offset;
+      if (offset + bit_count > BITS_PER_WORD) {
+        _words.emplace_back(word >> (BITS_PER_WORD - offset));
+      }
+    }
+    _size += bit_count;
+  }
+}
+
+void NullBitmap::reserve(const size_t size) {
+  _words.reserve((size + BITS_PER_WORD - 1) / BITS_PER_WORD);
+}
+
+void NullBitmap::shrink_to_fit() {
+  _words.shrink_to_fit();
+}
+
+void NullBitmap::resize(const size_t size, const bool value) {
+  if (size > _size && value) {
+    // Sets the bits of the old last word that are beyond the old size, then appends full words.
+    if (_size % BITS_PER_WORD != 0) {
+      _words.back() |= ~uint64_t{0} << (_size % BITS_PER_WORD);
+    }
+  }
+  _words.resize((size + BITS_PER_WORD - 1) / BITS_PER_WORD, value ? ~uint64_t{0} : uint64_t{0});
+  _size = size;
+  _clear_padding();
+}
+
+size_t NullBitmap::size() const {
+  return _size;
+}
+
+bool NullBitmap::empty() const {
+  return _size == 0;
+}
+
+size_t NullBitmap::count() const {
+  auto count = size_t{0};
+  for (const auto word : _words) {
+    count += std::popcount(word);
+  }
+  return count;
+}
+
+size_t NullBitmap::find_next_set(const size_t begin) const {
+  if (begin >= _size) {
+    return _size;
+  }
+  auto word_index = begin / BITS_PER_WORD;
+  // Masks out the bits before begin in the first word.
+  auto word = _words[word_index] & (~uint64_t{0} << (begin % BITS_PER_WORD));
+  while (word == 0) {
+    ++word_index;
+    if (word_index == _words.size()) {
+      return _size;
+    }
+    word = _words[word_index];
+  }
+  return word_index * BITS_PER_WORD + std::countr_zero(word);
+}
+
+NullBitmap& NullBitmap::operator&=(const NullBitmap& mask) {
+  Assert(_size == mask._size, "Bitmaps need to have the same size.");
+  std::transform(_words.begin(), _words.end(), mask._words.begin(), _words.begin(), std::bit_and<>{});
+  return *this;
+}
+
+NullBitmap& NullBitmap::operator|=(const NullBitmap& other) {
+  Assert(_size == other._size, "Bitmaps need to have the same size.");
+  std::transform(_words.begin(), _words.end(), other._words.begin(), _words.begin(), std::bit_or<>{});
+  return *this;
+}
+
+bool NullBitmap::operator==(const NullBitmap& other) const {
+  return _size == other._size && _words == other._words;
+}
+
+const std::vector<uint64_t>& NullBitmap::words() const {
+  return _words;
+}
+
+size_t NullBitmap::estimate_memory_usage() const {
+  return sizeof(uint64_t) * _words.capacity();
+}
+
+void NullBitmap::_clear_padding() {
+  if (_size % BITS_PER_WORD != 0) {
+    _words.back() &= ~uint64_t{0} >> (BITS_PER_WORD - _size % BITS_PER_WORD);
+  }
+}
+
+}  // namespace opossum
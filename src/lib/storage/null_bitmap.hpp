@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// NullBitmap stores one bit per row, where a set bit marks a NULL value. Unlike std::vector<bool>, the underlying
+// 64-bit words are exposed, so that operators can handle 64 rows at a time, e.g., by combining the words with the
+// match masks of a scan. Bits beyond size() in the last word are always zero.
+class NullBitmap {
+ public:
+  static constexpr auto BITS_PER_WORD = size_t{64};
+
+  NullBitmap() = default;
+
+  // Creates a bitmap with size bits, all set to value.
+  explicit NullBitmap(const size_t size, const bool value = false);
+
+  // Creates a bitmap with size bits that adopts the given words, e.g., when loading it from a file. words needs to hold
+  // exactly the words required for size bits.
+  NullBitmap(std::vector<uint64_t>&& words, const size_t size);
+
+  // Returns whether the bit at a given position is set. This is not bounds-checked.
+  bool operator[](const size_t index) const {
+    return (_words[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & uint64_t{1};
+  }
+
+  void set(const size_t index, const bool value);
+
+  void push_back(const bool value);
+
+  // Appends size bits, all set to value.
+  void append(const size_t size, const bool value);
+
+  // Appends the bits [begin, end) of other, 64 bits at a time.
+  void append(const NullBitmap& other, const size_t begin, const size_t end);
+
+  void reserve(const size_t size);
+
+  void shrink_to_fit();
+
+  void resize(const size_t size, const bool value = false);
+
+  size_t size() const;
+
+  bool empty() const;
+
+  // Returns the number of set bits.
+  size_t count() const;
+
+  // Returns the position of the first set bit at or after begin, or size() if there is none.
+  size_t find_next_set(const size_t begin) const;
+
+  // Clears all bits that are not set in mask. Both bitmaps need to have the same size.
+  NullBitmap& operator&=(const NullBitmap& mask);
+
+  // Sets all bits that are set in other. Both bitmaps need to have the same size.
+  NullBitmap& operator|=(const NullBitmap& other);
+
+  bool operator==(const NullBitmap& other) const;
+
+  // Returns the underlying words. Bit i of the bitmap is bit (i % 64) of word (i / 64).
+  const std::vector<uint64_t>& words() const;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  std::vector<uint64_t> _words;
+  size_t _size{0};
+
+  // Clears the bits beyond size() in the last word.
+  void _clear_padding();
+};
+
+}  // namespace opossum
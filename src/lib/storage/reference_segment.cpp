@@ -6,38 +6,39 @@
 namespace opossum {
 
 ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table>& referenced_table,
-                                   const ColumnID referenced_column_id, const std::shared_ptr<const PosList>& pos) {
-  // Implementation goes here
+                                   const ColumnID referenced_column_id, const std::shared_ptr<const PosList>& pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {
+  Assert(referenced_column_id < referenced_table->column_count(), "Referenced column does not exist.");
 }
 
 AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
-  // Implementation goes here
-  Fail("Implementation is missing.");
+  const auto& row_id = _pos_list->at(chunk_offset);
+  if (row_id.is_null()) {
+    return NULL_VALUE;
+  }
+  const auto chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk->get_segment(_referenced_column_id))[row_id.chunk_offset];
 }
 
 ChunkOffset ReferenceSegment::size() const {
-  // Implementation goes here
-  Fail("Implementation is missing.");
+  return static_cast<ChunkOffset>(_pos_list->size());
 }
 
 const std::shared_ptr<const PosList>& ReferenceSegment::pos_list() const {
-  // Implementation goes here
-  Fail("Implementation is missing.");
+  return _pos_list;
 }
 
 const std::shared_ptr<const Table>& ReferenceSegment::referenced_table() const {
-  // Implementation goes here
-  Fail("Implementation is missing.");
+  return _referenced_table;
 }
 
 ColumnID ReferenceSegment::referenced_column_id() const {
-  // Implementation goes here
-  Fail("Implementation is missing.");
+  return _referenced_column_id;
 }
 
 size_t ReferenceSegment::estimate_memory_usage() const {
-  // Implementation goes here
-  Fail("Implementation is missing.");
+  // The position list is usually shared by all segments of a chunk, but we account for it in every segment.
+  return sizeof(RowID) * _pos_list->size();
 }
 
 }  // namespace opossum
@@ -0,0 +1,135 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+
+#include "utils/assert.hpp"
+#include "utils/comparator.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
+  Assert(value_segment, "Can only construct a RunLengthSegment from a value segment of matching type.");
+
+  const auto& values = value_segment->values();
+  const auto num_values = static_cast<ChunkOffset>(values.size());
+  const auto is_nullable = value_segment->is_nullable();
+
+  for (auto offset = ChunkOffset{0}; offset < num_values; ++offset) {
+    const auto is_null = is_nullable && value_segment->null_values()[offset];
+    // A row continues the current run if both are NULL or both hold the same value. Note that we must not compare the
+    // values of NULL rows, as they are only placeholders.
+    const auto continues_run =
+        !_end_positions.empty() && _null_values[_null_values.size() - 1] == is_null &&
+        (is_null || _values.back() == values[offset]);
+    if (continues_run) {
+      _end_positions.back() = offset;
+      continue;
+    }
+
+    _values.emplace_back(is_null ? T{} : values[offset]);
+    _null_values.push_back(is_null);
+    _end_positions.emplace_back(offset);
+  }
+
+  _values.shrink_to_fit();
+  _null_values.shrink_to_fit();
+  _end_positions.shrink_to_fit();
+}
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(std::vector<T>&& values, NullBitmap&& null_values,
+                                      std::vector<ChunkOffset>&& end_positions)
+    : _values(std::move(values)), _null_values(std::move(null_values)), _end_positions(std::move(end_positions)) {
+  Assert(_values.size() == _null_values.size() && _values.size() == _end_positions.size(),
+         "Every run needs a value, a NULL flag, and an end position.");
+  Assert(std::adjacent_find(_end_positions.begin(), _end_positions.end(), std::greater_equal<ChunkOffset>{}) ==
+             _end_positions.end(),
+         "End positions need to be strictly ascending.");
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  const auto optional_value = get_typed_value(chunk_offset);
+  if (optional_value) {
+    return optional_value.value();
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+T RunLengthSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional_value = get_typed_value(chunk_offset);
+  Assert(optional_value, "Trying to access data that points to a NULL_VALUE.");
+  return optional_value.value();
+}
+
+template <typename T>
+std::optional<T> RunLengthSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  const auto run_index = _run_index(chunk_offset);
+  if (_null_values[run_index]) {
+    return std::nullopt;
+  }
+  return _values[run_index];
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::_run_index(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Invalid chunk offset given.");
+  // The first run whose end position is not smaller than the offset contains the offset.
+  const auto run = std::lower_bound(_end_positions.begin(), _end_positions.end(), chunk_offset);
+  return static_cast<size_t>(std::distance(_end_positions.begin(), run));
+}
+
+template <typename T>
+const std::vector<T>& RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const NullBitmap& RunLengthSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+const std::vector<ChunkOffset>& RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+void RunLengthSegment<T>::scan(const ScanType scan_type, const T& search_value, const ChunkID chunk_id,
+                               PosList& matches) const {
+  with_comparator(scan_type, [&](auto comparator) {
+    const auto run_count = _values.size();
+    auto run_begin = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < run_count; ++run_index) {
+      const auto run_end = _end_positions[run_index];
+      if (!_null_values[run_index] && comparator(_values[run_index], search_value)) {
+        for (auto chunk_offset = run_begin; chunk_offset <= run_end; ++chunk_offset) {
+          matches.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+      run_begin = run_end + 1;
+    }
+  });
+}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::size() const {
+  if (_end_positions.empty()) {
+    return ChunkOffset{0};
+  }
+  return _end_positions.back() + 1;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return sizeof(T) * _values.capacity() + sizeof(ChunkOffset) * _end_positions.capacity() +
+         _null_values.estimate_memory_usage();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "abstract_segment.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is a segment type that compresses consecutive identical values (runs) into a single entry. For
+// every run, it stores the value, whether the run consists of NULL values, and the chunk offset of the run's last row.
+template <typename T>
+class RunLengthSegment : public AbstractSegment {
+ public:
+  /**
+   * Creates a RunLength segment from a given value segment.
+   */
+  explicit RunLengthSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Adopts the runs of a segment (see values(), null_values(), and end_positions()), e.g., when loading it from a file.
+  RunLengthSegment(std::vector<T>&& values, NullBitmap&& null_values, std::vector<ChunkOffset>&& end_positions);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL. Finding the run the offset
+  // belongs to requires a binary search over the run end positions.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns the value of each run. The value of NULL runs is undefined.
+  const std::vector<T>& values() const;
+
+  // Returns a bitmap with one bit per run that is set if the run consists of NULL values.
+  const NullBitmap& null_values() const;
+
+  // Returns the (inclusive) chunk offset each run ends at.
+  const std::vector<ChunkOffset>& end_positions() const;
+
+  // Appends the positions of all rows that satisfy the predicate "value <scan_type> search_value" to matches. The
+  // predicate is only evaluated once per run. NULL values never match.
+  void scan(const ScanType scan_type, const T& search_value, const ChunkID chunk_id, PosList& matches) const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::vector<T> _values;
+  NullBitmap _null_values;
+  std::vector<ChunkOffset> _end_positions;
+
+  // Returns the index of the run a chunk offset belongs to.
+  size_t _run_index(const ChunkOffset chunk_offset) const;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
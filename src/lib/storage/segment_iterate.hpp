@@ -0,0 +1,305 @@
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/bit_packed_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/external_segment.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Typed access to the rows of segments, without a virtual call or an AllTypeVariant per row.
+ *
+ * AbstractSegment::operator[] is convenient, but it is a virtual call that boxes every value into an AllTypeVariant,
+ * and AbstractAttributeVector::get() is a bounds-checked virtual call as well. Instead, operators resolve a segment to
+ * its concrete type once and then run a loop that the compiler can inline:
+ *
+ *   segment_iterate<T>(segment, [&](const auto& position) {
+ *     if (!position.is_null() && position.value() < search_value) {
+ *       matches.emplace_back(RowID{chunk_id, position.chunk_offset()});
+ *     }
+ *   });
+ *
+ * The functor is instantiated once per segment type, so it needs to be generic. For numeric types, value() is a T. For
+ * strings, it is a std::string_view wherever the segment stores the string as is, and a std::string only for
+ * dictionaries that are compressed with FSST. The value of a NULL row is unspecified.
+ */
+template <typename Value>
+class SegmentPosition {
+ public:
+  SegmentPosition(const Value& value, const bool is_null, const ChunkOffset chunk_offset)
+      : _value(value), _is_null(is_null), _chunk_offset(chunk_offset) {}
+
+  const Value& value() const {
+    return _value;
+  }
+
+  bool is_null() const {
+    return _is_null;
+  }
+
+  ChunkOffset chunk_offset() const {
+    return _chunk_offset;
+  }
+
+ private:
+  Value _value;
+  bool _is_null;
+  ChunkOffset _chunk_offset;
+};
+
+// Casts a segment to its actual type and passes it on to a generic lambda. All segments but ReferenceSegments also
+// provide a non-virtual get_typed_value(), which can be used for accessing single rows.
+template <typename T, typename Functor>
+void resolve_segment_type(const AbstractSegment& segment, const Functor& func) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    return func(*value_segment);
+  }
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    return func(*dictionary_segment);
+  }
+  if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    return func(*reference_segment);
+  }
+  if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    return func(*run_length_segment);
+  }
+  if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+    if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      return func(*frame_of_reference_segment);
+    }
+  }
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (const auto* external_segment = dynamic_cast<const ExternalSegment<T>*>(&segment)) {
+      return func(*external_segment);
+    }
+  }
+  Fail("Unsupported segment type.");
+}
+
+// Casts an attribute vector to its actual type, i.e., a FixedWidthIntegerVector of some width or a BitPackedVector,
+// and passes it on to a generic lambda.
+template <typename Functor>
+void resolve_attribute_vector_type(const AbstractAttributeVector& attribute_vector, const Functor& func) {
+  if (const auto* vector = dynamic_cast<const FixedWidthIntegerVector<uint8_t>*>(&attribute_vector)) {
+    return func(*vector);
+  }
+  if (const auto* vector = dynamic_cast<const FixedWidthIntegerVector<uint16_t>*>(&attribute_vector)) {
+    return func(*vector);
+  }
+  if (const auto* vector = dynamic_cast<const FixedWidthIntegerVector<uint32_t>*>(&attribute_vector)) {
+    return func(*vector);
+  }
+  if (const auto* vector = dynamic_cast<const BitPackedVector*>(&attribute_vector)) {
+    return func(*vector);
+  }
+  Fail("Unsupported attribute vector type.");
+}
+
+namespace detail {
+
+// Strings are handed out as views wherever the segment stores them as they are.
+template <typename T>
+using ValueView = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+// Number of value ids that are decoded at once when iterating over a bit-packed attribute vector.
+constexpr auto ITERATE_DECODE_BLOCK_SIZE = size_t{2048};
+
+// Calls value_at(chunk_offset) for the offsets [0, size), or, if positions is given, for the chunk offsets of the
+// positions. In the latter case, the yielded chunk offset is the index into positions.
+template <typename ValueAt, typename Functor>
+void iterate_offsets(const ChunkOffset size, const std::span<const RowID>* positions, const ValueAt& value_at,
+                     const Functor& functor) {
+  if (positions) {
+    const auto position_count = static_cast<ChunkOffset>(positions->size());
+    for (auto index = ChunkOffset{0}; index < position_count; ++index) {
+      value_at((*positions)[index].chunk_offset, index, functor);
+    }
+    return;
+  }
+  for (auto offset = ChunkOffset{0}; offset < size; ++offset) {
+    value_at(offset, offset, functor);
+  }
+}
+
+template <typename T, typename Functor>
+void iterate(const ValueSegment<T>& segment, const std::span<const RowID>* positions, const Functor& functor) {
+  const auto& values = segment.values();
+  const auto* null_values = segment.is_nullable() ? &segment.null_values() : nullptr;
+  const auto value_at = [&](const ChunkOffset offset, const ChunkOffset output_offset, const auto& output) {
+    output(SegmentPosition<ValueView<T>>{values[offset], null_values && (*null_values)[offset], output_offset});
+  };
+  iterate_offsets(segment.size(), positions, value_at, functor);
+}
+
+template <typename T, typename Functor>
+void iterate(const ExternalSegment<T>& segment, const std::span<const RowID>* positions, const Functor& functor) {
+  const auto values = segment.values();
+  const auto* null_values = segment.is_nullable() ? &segment.null_values() : nullptr;
+  const auto value_at = [&](const ChunkOffset offset, const ChunkOffset output_offset, const auto& output) {
+    output(SegmentPosition<T>{values[offset], null_values && (*null_values)[offset], output_offset});
+  };
+  iterate_offsets(segment.size(), positions, value_at, functor);
+}
+
+template <typename T, typename Functor>
+void iterate(const DictionarySegment<T>& segment, const std::span<const RowID>* positions, const Functor& functor) {
+  const auto& dictionary = segment.dictionary();
+  const auto null_value_id = segment.null_value_id();
+
+  // Looks up the value of a value id once the type of the attribute vector and the dictionary access are resolved.
+  const auto iterate_with = [&](const auto& value_of, const auto& value_id_at) {
+    using Value = std::decay_t<decltype(value_of(ValueID{0}))>;
+    const auto value_at = [&](const ChunkOffset offset, const ChunkOffset output_offset, const auto& output) {
+      const auto value_id = value_id_at(offset);
+      const auto is_null = value_id == null_value_id;
+      output(SegmentPosition<Value>{is_null ? Value{} : value_of(value_id), is_null, output_offset});
+    };
+    iterate_offsets(segment.size(), positions, value_at, functor);
+  };
+
+  const auto iterate_with_dictionary = [&](const auto& value_id_at) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      if (dictionary.is_compressed()) {
+        return iterate_with([&](const ValueID value_id) { return dictionary.get(value_id); }, value_id_at);
+      }
+    }
+    iterate_with([&](const ValueID value_id) { return dictionary[value_id]; }, value_id_at);
+  };
+
+  resolve_attribute_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    using AttributeVector = std::decay_t<decltype(attribute_vector)>;
+    if constexpr (std::is_same_v<AttributeVector, BitPackedVector>) {
+      if (positions) {
+        // Single value ids are unpacked directly. As the type is resolved, get() is not called virtually.
+        return iterate_with_dictionary([&](const ChunkOffset offset) { return attribute_vector.get(offset); });
+      }
+      // Sequential accesses decode the value ids block by block.
+      auto value_ids = std::vector<ValueID>{};
+      auto block_begin = size_t{0};
+      iterate_with_dictionary([&](const ChunkOffset offset) {
+        if (offset == block_begin + value_ids.size()) {
+          block_begin = offset;
+          attribute_vector.decode_range(block_begin,
+                                        std::min(block_begin + ITERATE_DECODE_BLOCK_SIZE, attribute_vector.size()),
+                                        value_ids);
+        }
+        return value_ids[offset - block_begin];
+      });
+    } else {
+      const auto* codes = attribute_vector.values().data();
+      iterate_with_dictionary([&](const ChunkOffset offset) { return ValueID{codes[offset]}; });
+    }
+  });
+}
+
+template <typename T, typename Functor>
+void iterate(const RunLengthSegment<T>& segment, const std::span<const RowID>* positions, const Functor& functor) {
+  using Value = ValueView<T>;
+  const auto& values = segment.values();
+  const auto& null_values = segment.null_values();
+  const auto& end_positions = segment.end_positions();
+  if (positions) {
+    // Single rows are found with a binary search over the end positions of the runs.
+    const auto value_at = [&](const ChunkOffset offset, const ChunkOffset output_offset, const auto& output) {
+      const auto run = std::lower_bound(end_positions.begin(), end_positions.end(), offset) - end_positions.begin();
+      output(SegmentPosition<Value>{Value{values[run]}, null_values[run], output_offset});
+    };
+    iterate_offsets(segment.size(), positions, value_at, functor);
+    return;
+  }
+  auto offset = ChunkOffset{0};
+  for (auto run = size_t{0}; run < values.size(); ++run) {
+    const auto value = Value{values[run]};
+    const auto is_null = static_cast<bool>(null_values[run]);
+    for (; offset <= end_positions[run]; ++offset) {
+      functor(SegmentPosition<Value>{value, is_null, offset});
+    }
+  }
+}
+
+template <typename T, typename Functor>
+void iterate(const FrameOfReferenceSegment<T>& segment, const std::span<const RowID>* positions,
+             const Functor& functor) {
+  const auto value_at = [&](const ChunkOffset offset, const ChunkOffset output_offset, const auto& output) {
+    const auto value = segment.get_typed_value(offset);
+    output(SegmentPosition<T>{value.value_or(T{}), !value, output_offset});
+  };
+  iterate_offsets(segment.size(), positions, value_at, functor);
+}
+
+}  // namespace detail
+
+// Calls functor with the SegmentPosition of the rows of a segment of data type T at the chunk offsets of positions,
+// which all need to point into the chunk of the segment. The chunk offset of each yielded SegmentPosition is the index
+// into positions. The segment cannot be a ReferenceSegment.
+template <typename T, typename Functor>
+void segment_iterate_filtered(const AbstractSegment& segment, const std::span<const RowID> positions,
+                              const Functor& functor) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      Fail("ReferenceSegments cannot be iterated with positions.");
+    } else {
+      detail::iterate(typed_segment, &positions, functor);
+    }
+  });
+}
+
+// Calls functor with the SegmentPosition of each row of a segment of data type T in the order of the rows.
+// ReferenceSegments yield the values of the rows they point to, where NULL row ids are NULL values. The referenced
+// segments are resolved once per run of positions that point into the same chunk.
+template <typename T, typename Functor>
+void segment_iterate(const AbstractSegment& segment, const Functor& functor) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      const auto& pos_list = *typed_segment.pos_list();
+      const auto& referenced_table = *typed_segment.referenced_table();
+      const auto referenced_column_id = typed_segment.referenced_column_id();
+      const auto pos_list_size = pos_list.size();
+      for (auto run_begin = size_t{0}; run_begin < pos_list_size;) {
+        const auto chunk_id = pos_list[run_begin].chunk_id;
+        auto run_end = run_begin + 1;
+        while (run_end < pos_list_size && pos_list[run_end].chunk_id == chunk_id) {
+          ++run_end;
+        }
+
+        const auto run_offset = static_cast<ChunkOffset>(run_begin);
+        if (pos_list[run_begin].is_null()) {
+          for (auto offset = run_offset; offset < run_end; ++offset) {
+            functor(SegmentPosition<detail::ValueView<T>>{{}, true, offset});
+          }
+        } else {
+          // The referenced positions yield their index in the run, which we shift to the offset in the segment.
+          const auto shift_offset = [&](const auto& position) {
+            using Value = std::decay_t<decltype(position.value())>;
+            functor(SegmentPosition<Value>{position.value(), position.is_null(),
+                                           static_cast<ChunkOffset>(run_offset + position.chunk_offset())});
+          };
+          const auto positions = std::span<const RowID>{pos_list.data() + run_begin, run_end - run_begin};
+          const auto& referenced_segment = *referenced_table.get_chunk(chunk_id)->get_segment(referenced_column_id);
+          segment_iterate_filtered<T>(referenced_segment, positions, shift_offset);
+        }
+        run_begin = run_end;
+      }
+    } else {
+      detail::iterate(typed_segment, nullptr, functor);
+    }
+  });
+}
+
+}  // namespace opossum
@@ -1,8 +1,21 @@
 #include "storage_manager.hpp"
 
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <unordered_set>
 #include <utility>
 
 #include "utils/assert.hpp"
+#include "utils/binary_table.hpp"
+
+namespace {
+
+// The manifest starts with a version line, followed by one line per table with its file name and its name.
+const auto MANIFEST_FILE_NAME = std::string{"manifest"};
+const auto MANIFEST_VERSION = std::string{"opossum-catalog 1"};
+
+}  // namespace
 
 namespace opossum {
 
@@ -54,6 +67,77 @@ void StorageManager::print(std::ostream& out) const {
   }
 }
 
+void StorageManager::save(const std::string& directory) const {
+  for (const auto& [name, table] : _tables) {
+    Assert(name.find('\n') == std::string::npos, "Table names with line breaks cannot be saved.");
+  }
+
+  // The table files of an earlier save in the same directory are overwritten. Its manifest is removed first, so that
+  // an interrupted save does not leave a manifest that refers to partly written files.
+  const auto manifest_path = std::filesystem::path{directory} / MANIFEST_FILE_NAME;
+  std::filesystem::create_directories(directory);
+  std::filesystem::remove(manifest_path);
+
+  // Table names may contain any character but line breaks, so the files are numbered instead of named after them.
+  auto file_names = std::vector<std::pair<std::string, std::string>>{};
+  auto saved_tables = std::vector<std::future<void>>{};
+  saved_tables.reserve(_tables.size());
+  for (const auto& [name, table] : _tables) {
+    const auto file_name = "table_" + std::to_string(file_names.size()) + ".bin";
+    file_names.emplace_back(file_name, name);
+    const auto path = (std::filesystem::path{directory} / file_name).string();
+    saved_tables.emplace_back(std::async(std::launch::async, [table = table, path]() {
+      save_binary_table(*table, path);
+    }));
+  }
+  for (auto& saved_table : saved_tables) {
+    saved_table.get();
+  }
+
+  // The manifest is written to a temporary file and renamed, so that it only appears once it is complete.
+  const auto temporary_manifest_path = std::filesystem::path{directory} / (MANIFEST_FILE_NAME + ".tmp");
+  auto manifest = std::ofstream{temporary_manifest_path, std::ios::trunc};
+  manifest << MANIFEST_VERSION << '\n';
+  for (const auto& [file_name, name] : file_names) {
+    manifest << file_name << ' ' << name << '\n';
+  }
+  manifest.close();
+  Assert(manifest.good(), "Could not write manifest to " + directory);
+  std::filesystem::rename(temporary_manifest_path, manifest_path);
+}
+
+void StorageManager::load(const std::string& directory, const bool map_files) {
+  auto manifest = std::ifstream{std::filesystem::path{directory} / MANIFEST_FILE_NAME};
+  Assert(manifest.is_open(), "Cannot find manifest in " + directory);
+  auto line = std::string{};
+  Assert(std::getline(manifest, line) && line == MANIFEST_VERSION, "Unsupported manifest in " + directory);
+
+  auto names = std::vector<std::string>{};
+  auto unique_names = std::unordered_set<std::string>{};
+  auto loaded_tables = std::vector<std::future<std::shared_ptr<Table>>>{};
+  while (std::getline(manifest, line)) {
+    const auto separator = line.find(' ');
+    Assert(separator != std::string::npos, "Invalid manifest line: " + line);
+    const auto& name = names.emplace_back(line.substr(separator + 1));
+    Assert(!has_table(name), "Table '" + name + "' already exists.");
+    Assert(unique_names.insert(name).second, "Table '" + name + "' appears twice in the manifest.");
+    const auto path = (std::filesystem::path{directory} / line.substr(0, separator)).string();
+    loaded_tables.emplace_back(std::async(std::launch::async, [path, map_files]() {
+      return map_files ? map_binary_table(path) : load_binary_table(path);
+    }));
+  }
+
+  // All tables are loaded before the first one is added, so that a failing load does not add some of them.
+  auto tables = std::vector<std::shared_ptr<Table>>{};
+  tables.reserve(loaded_tables.size());
+  for (auto& loaded_table : loaded_tables) {
+    tables.emplace_back(loaded_table.get());
+  }
+  for (auto table_id = size_t{0}; table_id < tables.size(); ++table_id) {
+    add_table(names[table_id], tables[table_id]);
+  }
+}
+
 void StorageManager::reset() {
   _tables.clear();
   // Clearing the map did only remove its entries, not change its capacity. Therefore, perform a rehash so that we
@@ -29,6 +29,16 @@ class StorageManager : private Noncopyable {
   // Prints information about all tables in the storage manager (name, #columns, #rows, #chunks).
   void print(std::ostream& out = std::cout) const;
 
+  // Writes all tables to the given directory, which is created if needed: one binary table file per table (see
+  // save_binary_table()) and a manifest that maps table names to files. The tables are written in parallel. Saving
+  // over an earlier save removes its manifest first and puts the new one in place last, so an interrupted save does
+  // not leave a directory that load() accepts.
+  void save(const std::string& directory) const;
+
+  // Adds all tables of a directory written by save(). The tables are loaded in parallel, or mapped if map_files is set
+  // (see map_binary_table()). None of the tables may exist yet, and the manifest may not list a name twice.
+  void load(const std::string& directory, bool map_files = false);
+
   // Deletes the entire StorageManager and creates a new one, used especially in tests.
   void reset();
 
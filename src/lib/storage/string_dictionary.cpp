@@ -0,0 +1,136 @@
+#include "string_dictionary.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/iterator/counting_iterator.hpp>
+
+#include "fsst_symbol_table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+StringDictionary::StringDictionary(const std::vector<std::string_view>& values, const bool compress) {
+  if (compress) {
+    _symbol_table = std::make_shared<FSSTSymbolTable>(values);
+  }
+
+  auto characters = std::vector<char>{};
+  auto offsets = std::vector<uint32_t>{0};
+  offsets.reserve(values.size() + 1);
+  auto encoded_value = std::string{};
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    const auto value = values[index];
+    DebugAssert(index == 0 || values[index - 1] < value, "Values have to be sorted and distinct.");
+    if (_symbol_table) {
+      encoded_value.clear();
+      _symbol_table->encode(value, encoded_value);
+      characters.insert(characters.end(), encoded_value.begin(), encoded_value.end());
+    } else {
+      characters.insert(characters.end(), value.begin(), value.end());
+    }
+    Assert(characters.size() <= std::numeric_limits<uint32_t>::max(), "Dictionary entries exceed 4 GB of characters.");
+    offsets.emplace_back(static_cast<uint32_t>(characters.size()));
+  }
+  characters.shrink_to_fit();
+  _characters = Buffer<char>{std::move(characters)};
+  _offsets = Buffer<uint32_t>{std::move(offsets)};
+}
+
+StringDictionary::StringDictionary(Buffer<char>&& characters, Buffer<uint32_t>&& offsets,
+                                   const std::shared_ptr<const FSSTSymbolTable>& symbol_table)
+    : _characters(std::move(characters)), _offsets(std::move(offsets)), _symbol_table(symbol_table) {
+  Assert(!_offsets.empty() && _offsets.front() == 0 && _offsets.back() == _characters.size(),
+         "Offsets do not match the characters.");
+  // Checking all offsets of an external buffer would page in all of them, so we only do this for owned buffers.
+  Assert(_offsets.is_external() || std::is_sorted(_offsets.begin(), _offsets.end()), "Offsets need to be ascending.");
+}
+
+std::string_view StringDictionary::operator[](const size_t index) const {
+  DebugAssert(!is_compressed(), "Entries of compressed dictionaries can only be accessed using get().");
+  return _stored_entry(index);
+}
+
+std::string StringDictionary::get(const size_t index) const {
+  if (!_symbol_table) {
+    return std::string{_stored_entry(index)};
+  }
+  auto value = std::string{};
+  _symbol_table->decode(_stored_entry(index), value);
+  return value;
+}
+
+bool StringDictionary::equals(const size_t index, const std::string_view value) const {
+  if (!_symbol_table) {
+    return _stored_entry(index) == value;
+  }
+  auto encoded_value = std::string{};
+  _symbol_table->encode(value, encoded_value);
+  return _stored_entry(index) == encoded_value;
+}
+
+bool StringDictionary::is_compressed() const {
+  return _symbol_table != nullptr;
+}
+
+std::shared_ptr<const FSSTSymbolTable> StringDictionary::symbol_table() const {
+  return _symbol_table;
+}
+
+std::string_view StringDictionary::_stored_entry(const size_t index) const {
+  DebugAssert(index < size(), "Invalid index given.");
+  const auto begin = _offsets[index];
+  return std::string_view{_characters.data() + begin, _offsets[index + 1] - begin};
+}
+
+size_t StringDictionary::size() const {
+  return _offsets.size() - 1;
+}
+
+size_t StringDictionary::capacity() const {
+  return size();
+}
+
+bool StringDictionary::empty() const {
+  return size() == 0;
+}
+
+template <typename Predicate>
+size_t StringDictionary::_partition_point(const Predicate& predicate) const {
+  const auto begin = boost::counting_iterator<size_t>{0};
+  const auto end = boost::counting_iterator<size_t>{size()};
+  if (!_symbol_table) {
+    return *std::partition_point(begin, end, [&](const auto index) { return predicate(_stored_entry(index)); });
+  }
+
+  // The lexicographic order is lost by the encoding, so we decode the entries we visit during the binary search.
+  auto decoded_value = std::string{};
+  return *std::partition_point(begin, end, [&](const auto index) {
+    decoded_value.clear();
+    _symbol_table->decode(_stored_entry(index), decoded_value);
+    return predicate(std::string_view{decoded_value});
+  });
+}
+
+size_t StringDictionary::lower_bound(const std::string_view value) const {
+  return _partition_point([&](const std::string_view entry) { return entry < value; });
+}
+
+size_t StringDictionary::upper_bound(const std::string_view value) const {
+  return _partition_point([&](const std::string_view entry) { return entry <= value; });
+}
+
+const Buffer<char>& StringDictionary::characters() const {
+  return _characters;
+}
+
+const Buffer<uint32_t>& StringDictionary::offsets() const {
+  return _offsets;
+}
+
+size_t StringDictionary::estimate_memory_usage() const {
+  const auto symbol_table_size = _symbol_table ? _symbol_table->estimate_memory_usage() : size_t{0};
+  return _characters.estimate_memory_usage() + _offsets.estimate_memory_usage() + symbol_table_size;
+}
+
+}  // namespace opossum
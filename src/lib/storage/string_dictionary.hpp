@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "buffer.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class FSSTSymbolTable;
+
+// StringDictionary stores the sorted, distinct values of a DictionarySegment<std::string>. Instead of one heap
+// allocation (plus the 32 byte std::string object) per entry, all characters are stored back-to-back in a single
+// buffer and entry i spans the characters [offsets[i], offsets[i + 1]). Short entries thus cost only their characters
+// and four bytes, and a binary search touches one contiguous block of memory.
+//
+// Optionally, the entries can be compressed with an FSSTSymbolTable learned from them. In that case, the buffer holds
+// the encoded entries, which have to be decoded for access and ordered comparisons. Equality checks work on the
+// encoded entries directly.
+class StringDictionary {
+ public:
+  StringDictionary() = default;
+
+  // Creates the dictionary from values that are already sorted and distinct.
+  explicit StringDictionary(const std::vector<std::string_view>& values, const bool compress = false);
+
+  // Adopts the character buffer and offsets of a dictionary (see characters() and offsets()), e.g., when loading it
+  // from a file. Both may live in a mapped file. If the entries are encoded, the symbol table used for encoding has to
+  // be given.
+  StringDictionary(Buffer<char>&& characters, Buffer<uint32_t>&& offsets,
+                   const std::shared_ptr<const FSSTSymbolTable>& symbol_table = nullptr);
+
+  // Returns the entry at a given position. The view stays valid as long as the dictionary exists. Only available for
+  // uncompressed dictionaries; use get() otherwise.
+  std::string_view operator[](const size_t index) const;
+
+  // Returns a copy of the entry at a given position, decoding it if necessary.
+  std::string get(const size_t index) const;
+
+  // Returns whether the entry at a given position equals value. For compressed dictionaries, value is encoded and the
+  // encoded bytes are compared, so the entry does not have to be decoded.
+  bool equals(const size_t index, const std::string_view value) const;
+
+  // Returns whether the entries are compressed.
+  bool is_compressed() const;
+
+  // Returns the symbol table used for compression, or nullptr if the dictionary is not compressed.
+  std::shared_ptr<const FSSTSymbolTable> symbol_table() const;
+
+  // Returns the number of entries.
+  size_t size() const;
+
+  // Returns the number of entries that fit without reallocation, which is always the number of entries, as a
+  // dictionary is immutable once constructed.
+  size_t capacity() const;
+
+  bool empty() const;
+
+  // Returns the index of the first entry that is >= value, or size() if there is none.
+  size_t lower_bound(const std::string_view value) const;
+
+  // Returns the index of the first entry that is > value, or size() if there is none.
+  size_t upper_bound(const std::string_view value) const;
+
+  // Returns the character buffer holding all (possibly encoded) entries.
+  const Buffer<char>& characters() const;
+
+  // Returns the start offsets of all entries into the character buffer, followed by the total number of characters.
+  const Buffer<uint32_t>& offsets() const;
+
+  // Returns the calculated memory usage of the characters, offsets, and symbol table.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  Buffer<char> _characters;
+  Buffer<uint32_t> _offsets{std::vector<uint32_t>{0}};
+  std::shared_ptr<const FSSTSymbolTable> _symbol_table;
+
+  // Returns the stored (possibly encoded) bytes of an entry.
+  std::string_view _stored_entry(const size_t index) const;
+
+  // Returns the index of the first entry for which predicate(entry) is false. Entries are decoded if necessary.
+  template <typename Predicate>
+  size_t _partition_point(const Predicate& predicate) const;
+};
+
+}  // namespace opossum
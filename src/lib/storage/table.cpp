@@ -1,9 +1,15 @@
 #include "table.hpp"
 
+#include <atomic>
 #include <mutex>
-#include <thread>
+#include "column_values.hpp"
 #include "dictionary_segment.hpp"
+#include "external_segment.hpp"
+#include "frame_of_reference_segment.hpp"
 #include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "statistics/segment_statistics.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
 
@@ -45,6 +51,15 @@ void Table::create_new_chunk() {
   _chunks.emplace_back(chunk);
 }
 
+void Table::emplace_chunk(const std::shared_ptr<Chunk> chunk) {
+  if (_chunks.size() == 1 && _chunks[0]->size() == 0) {
+    _chunks[0] = chunk;
+    return;
+  }
+  Assert(_chunks.size() < std::numeric_limits<ChunkID>::max(), "Chunk limit is already reached.");
+  _chunks.emplace_back(chunk);
+}
+
 void Table::append(const std::vector<AllTypeVariant>& values) {
   if (_chunks.back()->size() == target_chunk_size()) {
     create_new_chunk();
@@ -52,6 +67,80 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
   _chunks.back()->append(values);
 }
 
+void Table::append_columns(const std::vector<std::shared_ptr<const AbstractColumnValues>>& columns) {
+  Assert(columns.size() == column_count(), "Number of columns does not match the table.");
+  if (columns.empty()) {
+    return;
+  }
+
+  // We validate all columns before appending anything, so that a failed call does not leave a partially appended
+  // batch behind.
+  const auto row_count = columns[0]->size();
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    const auto& column = columns[column_id];
+    Assert(column && column->size() == row_count, "All columns need to have the same number of rows.");
+    Assert(_column_nullables[column_id] || !column->contains_null(0, row_count),
+           "Trying to append NullValue to not nullable column.");
+    resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      Assert(std::dynamic_pointer_cast<const ColumnValues<ColumnDataType>>(column),
+             "Column values do not match the column type.");
+    });
+  }
+
+  for (auto begin = size_t{0}; begin < row_count;) {
+    if (_chunks.back()->size() == target_chunk_size()) {
+      create_new_chunk();
+    }
+    const auto end = std::min(row_count, begin + (target_chunk_size() - _chunks.back()->size()));
+    _chunks.back()->append_columns(columns, begin, end);
+    begin = end;
+  }
+}
+
+void Table::append_chunk(const std::vector<std::shared_ptr<AbstractSegment>>& segments) {
+  Assert(segments.size() == column_count(), "Number of segments does not match the table.");
+  const auto chunk = std::make_shared<Chunk>();
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    const auto& segment = segments[column_id];
+    Assert(segment && segment->size() == segments[0]->size(), "All segments need to have the same number of rows.");
+    Assert(segment->size() <= target_chunk_size(), "Segments exceed the target chunk size.");
+    resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto check_nulls = [&](const auto& typed_segment) {
+        Assert(_column_nullables[column_id] || !typed_segment.is_nullable() ||
+                   typed_segment.null_values().find_next_set(0) == typed_segment.size(),
+               "Trying to append NullValue to not nullable column.");
+      };
+      if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment)) {
+        return check_nulls(*value_segment);
+      }
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        if (const auto external_segment = std::dynamic_pointer_cast<const ExternalSegment<ColumnDataType>>(segment)) {
+          return check_nulls(*external_segment);
+        }
+      }
+      // Encoded segments are adopted as well, e.g., when they are imported or loaded from disk.
+      auto is_encoded_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment) ||
+                                std::dynamic_pointer_cast<const RunLengthSegment<ColumnDataType>>(segment);
+      if constexpr (std::is_integral_v<ColumnDataType>) {
+        is_encoded_segment |= static_cast<bool>(
+            std::dynamic_pointer_cast<const FrameOfReferenceSegment<ColumnDataType>>(segment));
+      }
+      Assert(is_encoded_segment, "Segment type does not match the column type.");
+    });
+    chunk->add_segment(segment);
+  }
+
+  if (_chunks.back()->size() == 0) {
+    _chunks.back() = chunk;
+  } else {
+    Assert(_chunks.size() < std::numeric_limits<ChunkID>::max(), "Chunk limit is already reached.");
+    _chunks.emplace_back(chunk);
+  }
+  create_new_chunk();
+}
+
 ColumnCount Table::column_count() const {
   // Narrowing conversion is ok because we make sure to never have so many columns that the value overflows.
   return static_cast<ColumnCount>(_column_names.size());
@@ -110,52 +199,234 @@ std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
   return _chunks[chunk_id];
 }
 
-void Table::_compress_segment_and_add_to_chunk(ColumnID index,
-                                               std::vector<std::shared_ptr<AbstractSegment>>& compressed_segments,
-                                               const std::shared_ptr<Chunk>& chunk_to_be_compressed) const {
-  const auto segment = chunk_to_be_compressed->get_segment(index);
-  resolve_data_type(column_type(index), [&index, &compressed_segments, &segment](const auto data_type_t) {
+void Table::_compress_segment_and_add_to_chunk(
+    ColumnID index, std::vector<std::shared_ptr<AbstractSegment>>& compressed_segments,
+    std::vector<std::shared_ptr<const AbstractSegmentStatistics>>& segment_statistics,
+    const std::shared_ptr<Chunk>& chunk_to_be_compressed, const EncodingType encoding_type) const {
+  auto segment = chunk_to_be_compressed->get_segment(index);
+  resolve_data_type(column_type(index), [&](const auto data_type_t) {
     using ColumnDataType = typename decltype(data_type_t)::type;
-    compressed_segments[index] = std::make_shared<DictionarySegment<ColumnDataType>>(segment);
+    // The encoders read ValueSegments, so external buffers are copied first.
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (const auto external_segment = std::dynamic_pointer_cast<ExternalSegment<ColumnDataType>>(segment)) {
+        segment = external_segment->to_value_segment();
+      }
+    }
+    switch (encoding_type) {
+      case EncodingType::Dictionary:
+        compressed_segments[index] =
+            std::make_shared<DictionarySegment<ColumnDataType>>(segment, VectorCompressionType::BitPacked);
+        break;
+      case EncodingType::FSSTDictionary:
+        compressed_segments[index] =
+            std::make_shared<DictionarySegment<ColumnDataType>>(segment, VectorCompressionType::BitPacked, true);
+        break;
+      case EncodingType::RunLength:
+        compressed_segments[index] = std::make_shared<RunLengthSegment<ColumnDataType>>(segment);
+        break;
+      case EncodingType::FrameOfReference:
+        if constexpr (std::is_integral_v<ColumnDataType>) {
+          compressed_segments[index] = std::make_shared<FrameOfReferenceSegment<ColumnDataType>>(segment);
+          break;
+        } else {
+          Fail("Frame-of-reference encoding is only supported for int and long columns.");
+        }
+    }
+    Assert(compressed_segments[index], "Unsupported encoding type.");
+    // The statistics are computed from the compressed segment, as this is cheap for sorted dictionaries.
+    segment_statistics[index] =
+        std::make_shared<SegmentStatistics<ColumnDataType>>(*compressed_segments[index], true);
   });
 }
 
-void Table::compress_chunk(const ChunkID chunk_id) {
+void Table::_check_encoding_type(const EncodingType encoding_type) const {
+  if (encoding_type == EncodingType::FrameOfReference) {
+    for (const auto& type : _column_types) {
+      Assert(type == "int" || type == "long",
+             "Frame-of-reference encoding is only supported for int and long columns.");
+    }
+  }
+}
+
+void Table::compress_chunk(const ChunkID chunk_id, const EncodingType encoding_type) {
+  auto compressed_chunk = compress_chunk_async(chunk_id, encoding_type);
+  WorkerPool::get().wait(compressed_chunk);
+  replace_chunk(chunk_id, compressed_chunk.get());
+}
+
+std::future<std::shared_ptr<Chunk>> Table::compress_chunk_async(const ChunkID chunk_id,
+                                                                const EncodingType encoding_type) {
   Assert(chunk_id < chunk_count(), "Chunk with ID does not exist");
+  // Exceptions thrown in the compression jobs are passed on through the future, but we check the encoding up front to
+  // fail before the chunk is touched.
+  _check_encoding_type(encoding_type);
   if (chunk_id == chunk_count() - 1) {
     create_new_chunk();
   }
 
-  const auto chunk_to_be_compressed = get_chunk(chunk_id);
+  // The state shared by the jobs that compress the segments of the chunk. Whichever job finishes last builds the
+  // compressed chunk, so no job needs to wait for the others. The jobs never touch _chunks, which the calling thread
+  // may change in the meantime, e.g., by appending rows.
+  struct ChunkCompression {
+    std::shared_ptr<Chunk> chunk_to_be_compressed;
+    std::vector<std::shared_ptr<AbstractSegment>> compressed_segments;
+    std::vector<std::shared_ptr<const AbstractSegmentStatistics>> segment_statistics;
+    std::atomic<size_t> remaining_segments;
+    std::mutex exception_mutex;
+    std::exception_ptr exception;
+    std::promise<std::shared_ptr<Chunk>> promise;
+  };
+
   const auto segment_count = column_count();
-  auto compression_threads = std::vector<std::thread>{};
-  compression_threads.reserve(segment_count);
-  auto compressed_segments = std::vector<std::shared_ptr<AbstractSegment>>{};
-  compressed_segments.resize(segment_count);
-  for (auto index = ColumnID{0}; index < segment_count; index++) {
-    compression_threads.emplace_back(&Table::_compress_segment_and_add_to_chunk, this, index,
-                                     std::ref(compressed_segments), std::cref(chunk_to_be_compressed));
+  const auto compression = std::make_shared<ChunkCompression>();
+  compression->chunk_to_be_compressed = get_chunk(chunk_id);
+  compression->compressed_segments.resize(segment_count);
+  compression->segment_statistics.resize(segment_count);
+  compression->remaining_segments = segment_count;
+  auto compressed_chunk = compression->promise.get_future();
+
+  const auto finish = [compression]() {
+    if (compression->exception) {
+      compression->promise.set_exception(compression->exception);
+      return;
+    }
+    const auto new_chunk = std::make_shared<Chunk>();
+    for (const auto& segment : compression->compressed_segments) {
+      new_chunk->add_segment(segment);
+    }
+    new_chunk->set_segment_statistics(compression->segment_statistics);
+    compression->promise.set_value(new_chunk);
+  };
+
+  if (segment_count == 0) {
+    finish();
+    return compressed_chunk;
   }
-  for (auto& thread : compression_threads) {
-    thread.join();
+
+  auto& worker_pool = WorkerPool::get();
+  for (auto index = ColumnID{0}; index < segment_count; ++index) {
+    worker_pool.schedule([this, index, encoding_type, compression, finish]() {
+      try {
+        _compress_segment_and_add_to_chunk(index, compression->compressed_segments, compression->segment_statistics,
+                                           compression->chunk_to_be_compressed, encoding_type);
+      } catch (...) {
+        const auto lock = std::lock_guard{compression->exception_mutex};
+        if (!compression->exception) {
+          compression->exception = std::current_exception();
+        }
+      }
+      // The last job sees the results of all other jobs, as the decrement orders their writes before its reads.
+      if (--compression->remaining_segments == 0) {
+        finish();
+      }
+    });
   }
+  return compressed_chunk;
+}
 
-  // Collect the segments we just compressed and insert them into a new chunk.
-  // Note that we needed to insert them in the compressed_segments vector first because we could not be sure in which
-  // order the threads used for compression would finish.
-  const auto new_chunk = std::make_shared<Chunk>();
+void Table::compress_all_chunks(const EncodingType encoding_type) {
+  _check_encoding_type(encoding_type);
+  const auto needs_compression = [&](const ChunkID chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (chunk->size() == 0 || column_count() == 0) {
+      return false;
+    }
+    // Encoders can only read unencoded segments, and all segments of a chunk are either encoded or not.
+    auto is_unencoded = false;
+    resolve_data_type(column_type(ColumnID{0}), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto segment = chunk->get_segment(ColumnID{0});
+      is_unencoded = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment) != nullptr;
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        is_unencoded |= std::dynamic_pointer_cast<ExternalSegment<ColumnDataType>>(segment) != nullptr;
+      }
+    });
+    return is_unencoded;
+  };
+
+  const auto initial_chunk_count = chunk_count();
+  auto chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < initial_chunk_count; ++chunk_id) {
+    if (needs_compression(chunk_id)) {
+      chunk_ids.emplace_back(chunk_id);
+    }
+  }
+  // The new chunk for appends is created before any job is scheduled, so the chunks are not changed while the jobs run.
+  if (!chunk_ids.empty() && chunk_ids.back() == initial_chunk_count - 1) {
+    create_new_chunk();
+  }
+
+  auto compressed_chunks = std::vector<std::future<std::shared_ptr<Chunk>>>{};
+  compressed_chunks.reserve(chunk_ids.size());
+  for (const auto chunk_id : chunk_ids) {
+    compressed_chunks.emplace_back(compress_chunk_async(chunk_id, encoding_type));
+  }
+
+  // Wait for all chunks before passing on the first exception, as the jobs refer to this table. The compressed chunks
+  // are swapped in by this thread, and only if all of them succeeded.
+  auto& worker_pool = WorkerPool::get();
+  for (const auto& compressed_chunk : compressed_chunks) {
+    worker_pool.wait(compressed_chunk);
+  }
+  auto new_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  new_chunks.reserve(compressed_chunks.size());
+  for (auto& compressed_chunk : compressed_chunks) {
+    new_chunks.emplace_back(compressed_chunk.get());
+  }
+  for (auto index = size_t{0}; index < chunk_ids.size(); ++index) {
+    replace_chunk(chunk_ids[index], new_chunks[index]);
+  }
+}
+
+void Table::replace_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk) {
+  Assert(chunk_id < chunk_count(), "Chunk with ID does not exist");
+  Assert(chunk->column_count() == column_count() && chunk->size() == _chunks[chunk_id]->size(),
+         "The new chunk needs to hold the same rows as the old one.");
+  // The old chunk stays valid until no-one is referencing it anymore (which is fine because both contain the same
+  // data). Somebody may still manually add rows to the chunk that was compressed, which we would miss, but doing that
+  // violates patterns of intended usage.
+  _chunks[chunk_id] = chunk;
+}
+
+std::shared_ptr<Chunk> Table::create_compressed_chunk(const std::shared_ptr<Chunk>& chunk,
+                                                      const EncodingType encoding_type) const {
+  Assert(chunk->column_count() == column_count(), "Chunk does not match the table's columns.");
+  _check_encoding_type(encoding_type);
+
+  const auto segment_count = column_count();
+  auto compressed_segments = std::vector<std::shared_ptr<AbstractSegment>>(segment_count);
+  auto segment_statistics = std::vector<std::shared_ptr<const AbstractSegmentStatistics>>(segment_count);
+  for (auto index = ColumnID{0}; index < segment_count; ++index) {
+    _compress_segment_and_add_to_chunk(index, compressed_segments, segment_statistics, chunk, encoding_type);
+  }
+
+  const auto compressed_chunk = std::make_shared<Chunk>();
   for (const auto& segment : compressed_segments) {
+    compressed_chunk->add_segment(segment);
+  }
+  compressed_chunk->set_segment_statistics(segment_statistics);
+  return compressed_chunk;
+}
+
+void Table::create_segment_statistics(const ChunkID chunk_id) {
+  Assert(chunk_id < chunk_count(), "Chunk with ID does not exist.");
+  const auto chunk = get_chunk(chunk_id);
+  Assert(chunk_id < chunk_count() - 1 || chunk->size() == target_chunk_size(),
+         "Statistics can only be created for sealed chunks.");
+
+  const auto new_chunk = std::make_shared<Chunk>();
+  auto segment_statistics = std::vector<std::shared_ptr<const AbstractSegmentStatistics>>{};
+  const auto segment_count = column_count();
+  for (auto column_id = ColumnID{0}; column_id < segment_count; ++column_id) {
+    const auto segment = chunk->get_segment(column_id);
     new_chunk->add_segment(segment);
+    resolve_data_type(column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      segment_statistics.emplace_back(std::make_shared<SegmentStatistics<ColumnDataType>>(*segment, true));
+    });
   }
-  // Swap out the old chunk with the compressed chunk. The old chunk will stay valid until no-one is referencing it
-  // anymore (which is fine because both contain the same data).
-  // Note that this will not lead to any data races regarding row insertion because, if we are told to compress
-  // the last chunk, we have created a new one before starting the compression. This new chunk will then receive the
-  // insertions.
-  // Somebody may still manually add rows to the chunk we are compressing, which we would miss during the compression,
-  // but since doing that is violates patterns of intended usage, we don't address this edge case here.
-  // (It would also be basically impossible to prevent that here by, e.g., locking access to the chunk,
-  // as somebody may already have a reference to that chunk).
+  new_chunk->set_segment_statistics(segment_statistics);
+  // As in compress_chunk, readers holding the old chunk are not affected.
   _chunks[chunk_id] = new_chunk;
 }
 
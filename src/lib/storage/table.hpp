@@ -1,5 +1,6 @@
 #pragma once
 
+#include <future>
 #include <mutex>
 #include "abstract_segment.hpp"
 #include "chunk.hpp"
@@ -7,6 +8,7 @@
 
 namespace opossum {
 
+class AbstractColumnValues;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
@@ -61,11 +63,57 @@ class Table : private Noncopyable {
   // purposes only.
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Inserts rows given column by column. columns[i] holds the values of the ith column and needs to be a ColumnValues
+  // of the column's type. All columns need to have the same number of rows. The rows fill up the last chunk, and new
+  // chunks are created whenever the target chunk size is reached. This is the preferred way to load large amounts of
+  // data, as values are copied in bulk instead of being wrapped in AllTypeVariants and cast one by one. Not
+  // thread-safe.
+  void append_columns(const std::vector<std::shared_ptr<const AbstractColumnValues>>& columns);
+
+  // Adds a chunk that consists of the given segments, which need to be of the columns' types (but not
+  // ReferenceSegments) and have the same number of rows (at most the target chunk size). The segments are adopted as
+  // they are, so a chunk of any size is attached in O(columns). Use the ValueSegment constructor that moves a
+  // std::vector<T> in, or wrap read-only buffers in ExternalSegments. The adopted chunk replaces the last chunk if that
+  // one is empty. Afterwards, a new chunk is created for subsequent appends, as only ValueSegments can be appended to.
+  // Not thread-safe.
+  void append_chunk(const std::vector<std::shared_ptr<AbstractSegment>>& segments);
+
   // Creates a new chunk and appends it.
   void create_new_chunk();
 
-  // Compresses a ValueColumn into a DictionaryColumn.
-  void compress_chunk(const ChunkID chunk_id);
+  // Adds a chunk to the table. If the first chunk is empty, it is replaced. This is used by operators, which first
+  // define the columns of their output table and then add chunk by chunk.
+  void emplace_chunk(const std::shared_ptr<Chunk> chunk);
+
+  // Compresses the ValueSegments of a chunk using the given encoding. For dictionary encoding, the value ids are
+  // bit-packed to save memory. FSSTDictionary additionally compresses the dictionaries of string columns. The
+  // compressed chunk also holds the statistics of its segments, including Bloom filters.
+  void compress_chunk(const ChunkID chunk_id, const EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Compresses a chunk like compress_chunk, but returns right away. The segments are compressed by jobs of the shared
+  // WorkerPool, one per column. The returned future holds the compressed chunk or the exceptions that the encoders
+  // threw. The jobs do not change the table, so the caller replaces the chunk with replace_chunk() once the future is
+  // ready. The table needs to stay alive until then.
+  std::future<std::shared_ptr<Chunk>> compress_chunk_async(const ChunkID chunk_id,
+                                                           const EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Replaces a chunk with one that holds the same rows, e.g., the compressed chunk from compress_chunk_async().
+  void replace_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk);
+
+  // Compresses all chunks that hold rows and are not encoded yet. One job per segment is scheduled on the shared
+  // WorkerPool, so all cores are used even for tables with few columns.
+  void compress_all_chunks(const EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Returns a compressed copy of a chunk that has this table's columns but does not need to be part of it, e.g.,
+  // because it was just loaded and is added with emplace_chunk() afterwards. Unlike compress_chunk, the segments are
+  // compressed one after another in the calling thread, so several chunks can be compressed concurrently by a pool of
+  // workers.
+  std::shared_ptr<Chunk> create_compressed_chunk(const std::shared_ptr<Chunk>& chunk,
+                                                 const EncodingType encoding_type = EncodingType::Dictionary) const;
+
+  // Computes the statistics (including Bloom filters) of a chunk without compressing it. The chunk must be sealed,
+  // i.e., no more rows may be appended to it. Like compress_chunk, this replaces the chunk with a new one.
+  void create_segment_statistics(const ChunkID chunk_id);
 
  protected:
   std::vector<std::shared_ptr<Chunk>> _chunks;
@@ -73,9 +121,11 @@ class Table : private Noncopyable {
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
   std::vector<bool> _column_nullables;
-  void _compress_segment_and_add_to_chunk(ColumnID index,
-                                          std::vector<std::shared_ptr<AbstractSegment>>& compressed_segments,
-                                          const std::shared_ptr<Chunk>& chunk_to_be_compressed) const;
+  void _check_encoding_type(const EncodingType encoding_type) const;
+  void _compress_segment_and_add_to_chunk(
+      ColumnID index, std::vector<std::shared_ptr<AbstractSegment>>& compressed_segments,
+      std::vector<std::shared_ptr<const AbstractSegmentStatistics>>& segment_statistics,
+      const std::shared_ptr<Chunk>& chunk_to_be_compressed, const EncodingType encoding_type) const;
 };
 
 }  // namespace opossum
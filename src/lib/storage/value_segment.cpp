@@ -8,29 +8,53 @@ namespace opossum {
 template <typename T>
 ValueSegment<T>::ValueSegment(bool nullable) {
   if (nullable) {
-    _nulls = std::vector<bool>{};
+    _nulls = NullBitmap{};
   }
 }
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::vector<T>&& values, std::optional<NullBitmap>&& null_values)
+    : _nulls(std::move(null_values)) {
+  Assert(values.size() <= std::numeric_limits<ChunkOffset>::max(), "Too many values for a single segment.");
+  Assert(!_nulls || _nulls->size() == values.size(), "NULL bitmap needs to have one bit per value.");
+  if constexpr (std::is_same_v<T, std::string>) {
+    _values.reserve(values.size());
+    for (const auto& value : values) {
+      _values.emplace_back(value);
+    }
+  } else {
+    _values = std::move(values);
+  }
+}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(GermanStringVector&& values, std::optional<NullBitmap>&& null_values)
+  requires std::is_same_v<T, std::string>
+    : _values(std::move(values)), _nulls(std::move(null_values)) {
+  Assert(_values.size() <= std::numeric_limits<ChunkOffset>::max(), "Too many values for a single segment.");
+  Assert(!_nulls || _nulls->size() == _values.size(), "NULL bitmap needs to have one bit per value.");
+}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   if (is_null(chunk_offset)) {
     return NULL_VALUE;
   }
 
-  return _values.at(chunk_offset);
+  return T{_values[chunk_offset]};
 }
 
 template <typename T>
 bool ValueSegment<T>::is_null(const ChunkOffset chunk_offset) const {
-  Assert(chunk_offset < size(), "Invalid chunk offset given.");
-  return _nulls.has_value() && _nulls.value()[chunk_offset];
+  DebugAssert(chunk_offset < size(), "Invalid chunk offset given.");
+  return _nulls.has_value() && (*_nulls)[chunk_offset];
 }
 
 template <typename T>
 T ValueSegment<T>::get(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Invalid chunk offset given.");
   Assert(!is_null(chunk_offset), "No value present at offset.");
-  return _values.at(chunk_offset);
+  return T{_values[chunk_offset]};
 }
 
 template <typename T>
@@ -47,27 +71,54 @@ void ValueSegment<T>::append(const AllTypeVariant& value) {
   if (variant_is_null(value)) {
     Assert(is_nullable(), "Trying to append NullValue to not nullable Segment.");
     _values.emplace_back();
-    _nulls->emplace_back(true);
+    _nulls->push_back(true);
     return;
   }
 
   try {
     _values.emplace_back(type_cast<T>(value));
     if (is_nullable()) {
-      _nulls->emplace_back(false);
+      _nulls->push_back(false);
     }
   } catch (boost::wrapexcept<boost::bad_lexical_cast>& e) {
     Fail("Cannot convert given value to type stored in segment.");
   }
 }
 
+template <typename T>
+void ValueSegment<T>::append(const ColumnValues<T>& column_values, const size_t begin, const size_t end) {
+  DebugAssert(begin <= end && end <= column_values.size(), "Invalid range given.");
+  const auto& nulls = column_values.nulls();
+  Assert(is_nullable() || !column_values.contains_null(begin, end),
+         "Trying to append NullValue to not nullable Segment.");
+
+  const auto& values = column_values.values();
+  if constexpr (std::is_same_v<T, std::string>) {
+    _values.reserve(_values.size() + (end - begin));
+    for (auto index = begin; index < end; ++index) {
+      _values.emplace_back(values[index]);
+    }
+  } else {
+    _values.insert(_values.end(), values.begin() + begin, values.begin() + end);
+  }
+
+  if (!is_nullable()) {
+    return;
+  }
+  if (nulls) {
+    _nulls->append(*nulls, begin, end);
+  } else {
+    _nulls->append(end - begin, false);
+  }
+}
+
 template <typename T>
 ChunkOffset ValueSegment<T>::size() const {
   return _values.size();
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
+const typename ValueSegment<T>::Values& ValueSegment<T>::values() const {
   return _values;
 }
 
@@ -77,13 +128,16 @@ bool ValueSegment<T>::is_nullable() const {
 }
 
 template <typename T>
-const std::vector<bool>& ValueSegment<T>::null_values() const {
+const NullBitmap& ValueSegment<T>::null_values() const {
   Assert(is_nullable(), "Can only get null_values for segment supporting them.");
   return _nulls.value();
 }
 
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return _values.estimate_memory_usage();
+  }
   return sizeof(T) * _values.capacity();
 }
 
@@ -1,19 +1,34 @@
 #pragma once
 
 #include "abstract_segment.hpp"
+#include "column_values.hpp"
+#include "german_string.hpp"
+#include "null_bitmap.hpp"
 
 namespace opossum {
 
-// ValueSegment is a segment type that stores all its values in a vector.
+// ValueSegment is a segment type that stores all its values in a vector. Strings are stored as 16 byte GermanStrings
+// instead of 32 byte std::strings, so that short strings live inline and most comparisons are decided by the length
+// and prefix.
 template <typename T>
 class ValueSegment : public AbstractSegment {
  public:
+  using Values = std::conditional_t<std::is_same_v<T, std::string>, GermanStringVector, std::vector<T>>;
+
   explicit ValueSegment(bool nullable = false);
 
+  // Creates a segment that adopts the given values without copying them (except for strings, which are converted to
+  // GermanStrings). If null_values is given, the segment is nullable, and the bitmap needs to have one bit per value.
+  explicit ValueSegment(std::vector<T>&& values, std::optional<NullBitmap>&& null_values = std::nullopt);
+
+  // Same as above, but adopts strings that are already stored as GermanStrings.
+  explicit ValueSegment(GermanStringVector&& values, std::optional<NullBitmap>&& null_values = std::nullopt)
+    requires std::is_same_v<T, std::string>;
+
   // Returns the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
-  // Returns whether a value is NULL.
+  // Returns whether a value is NULL. The chunk offset is only checked in debug builds.
   bool is_null(const ChunkOffset chunk_offset) const;
 
   // Returns the value at a certain position. Throws an error if value is NULL.
@@ -25,28 +40,34 @@ class ValueSegment : public AbstractSegment {
   // Adds a value at the end of the segment.
   void append(const AllTypeVariant& value);
 
+  // Adds the rows [begin, end) of column_values at the end of the segment. Unlike appending single AllTypeVariants,
+  // this copies the values in bulk without any casts.
+  void append(const ColumnValues<T>& column_values, const size_t begin, const size_t end);
+
   // Returns the number of entries.
   ChunkOffset size() const final;
 
   // Returns all values. This is the preferred method to check a value at a certain index. Usually you need to access
   // more than a single value anyway.
-  // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop. For strings, values[i] is a
+  // std::string_view.
+  const Values& values() const;
 
   // Returns whether segment supports NULL values.
   bool is_nullable() const;
 
-  // Returns NULL value vector that indicates whether a value is NULL with true at position i. Throw an exception if
-  // is_nullable() returns false. This is the preferred method to check for a NULL value at a certain index. Usually
-  // you need to access more than a single value anyway.
-  const std::vector<bool>& null_values() const;
+  // Returns NULL value bitmap that indicates whether a value is NULL with a set bit at position i. Throw an exception
+  // if is_nullable() returns false. This is the preferred method to check for a NULL value at a certain index. Usually
+  // you need to access more than a single value anyway, in which case the words of the bitmap can be processed
+  // 64 rows at a time.
+  const NullBitmap& null_values() const;
 
   // Returns the calculated memory usage.
   size_t estimate_memory_usage() const final;
 
  protected:
-  std::vector<T> _values;
-  std::optional<std::vector<bool>> _nulls;
+  Values _values;
+  std::optional<NullBitmap> _nulls;
 };
 
 EXPLICITLY_DECLARE_DATA_TYPES(ValueSegment);
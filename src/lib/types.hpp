@@ -71,6 +71,14 @@ constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max(
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
+// Selects the segment type Table::compress_chunk encodes value segments with. FrameOfReference is only supported for
+// integral columns. FSSTDictionary is dictionary encoding with compressed string dictionaries; for non-string columns,
+// it is the same as Dictionary.
+enum class EncodingType { Dictionary, RunLength, FrameOfReference, FSSTDictionary };
+
+// Selects the AbstractAttributeVector implementation a DictionarySegment uses for its value ids.
+enum class VectorCompressionType { FixedWidthInteger, BitPacked };
+
 using PosList = std::vector<RowID>;
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
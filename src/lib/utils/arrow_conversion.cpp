@@ -0,0 +1,502 @@
+#include "arrow_conversion.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/external_segment.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Arrow bitmaps store the least significant bit first, which matches the words of a NullBitmap on little-endian
+// machines.
+static_assert(std::endian::native == std::endian::little, "Arrow conversion requires a little-endian machine.");
+
+// Number of value ids that are decoded at once when exporting a DictionarySegment.
+constexpr auto DECODE_BLOCK_SIZE = size_t{2048};
+
+template <typename T>
+constexpr const char* arrow_format() {
+  if constexpr (std::is_same_v<T, int32_t>) {
+    return "i";
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    return "l";
+  } else if constexpr (std::is_same_v<T, float>) {
+    return "f";
+  } else if constexpr (std::is_same_v<T, double>) {
+    return "g";
+  } else {
+    static_assert(std::is_same_v<T, std::string>, "Unsupported data type.");
+    return "u";
+  }
+}
+
+std::string data_type_of_arrow_format(const std::string_view format) {
+  auto data_type = std::string{};
+  hana::for_each(data_types, [&](const auto& pair) {
+    using ColumnDataType = typename decltype(+hana::second(pair))::type;
+    if (format == arrow_format<ColumnDataType>()) {
+      data_type = hana::first(pair);
+    }
+  });
+  Assert(!data_type.empty(), "Unsupported Arrow format '" + std::string{format} + "'.");
+  return data_type;
+}
+
+// Owns everything an exported ArrowSchema points to. It is deleted by the release callback.
+struct ExportedSchema {
+  std::string format;
+  std::string name;
+  std::vector<std::unique_ptr<ArrowSchema>> children;
+  std::vector<ArrowSchema*> child_pointers;
+  std::unique_ptr<ArrowSchema> dictionary;
+
+  ~ExportedSchema() {
+    // Consumers may have moved children out, in which case they are already marked as released.
+    for (const auto& child : children) {
+      if (child->release) {
+        child->release(child.get());
+      }
+    }
+    if (dictionary && dictionary->release) {
+      dictionary->release(dictionary.get());
+    }
+  }
+};
+
+void release_schema(ArrowSchema* schema) {
+  delete static_cast<ExportedSchema*>(schema->private_data);
+  schema->release = nullptr;
+}
+
+ExportedSchema& initialize_schema(ArrowSchema& schema, const std::string& format, const std::string& name,
+                                  const int64_t flags) {
+  auto* exported_schema = new ExportedSchema{};
+  exported_schema->format = format;
+  exported_schema->name = name;
+  schema = ArrowSchema{exported_schema->format.c_str(), exported_schema->name.c_str(), nullptr, flags, 0, nullptr,
+                       nullptr, &release_schema, exported_schema};
+  return *exported_schema;
+}
+
+ArrowSchema& add_child(ArrowSchema& schema) {
+  auto& exported_schema = *static_cast<ExportedSchema*>(schema.private_data);
+  exported_schema.children.emplace_back(std::make_unique<ArrowSchema>());
+  exported_schema.child_pointers.emplace_back(exported_schema.children.back().get());
+  schema.n_children = static_cast<int64_t>(exported_schema.child_pointers.size());
+  schema.children = exported_schema.child_pointers.data();
+  return *exported_schema.children.back();
+}
+
+ArrowSchema& add_dictionary(ArrowSchema& schema) {
+  auto& exported_schema = *static_cast<ExportedSchema*>(schema.private_data);
+  exported_schema.dictionary = std::make_unique<ArrowSchema>();
+  schema.dictionary = exported_schema.dictionary.get();
+  return *schema.dictionary;
+}
+
+// Owns everything an exported ArrowArray points to, including the segments and copied buffers the Arrow buffers point
+// into. It is deleted by the release callback.
+struct ExportedArray {
+  std::vector<const void*> buffers;
+  std::vector<std::unique_ptr<ArrowArray>> children;
+  std::vector<ArrowArray*> child_pointers;
+  std::unique_ptr<ArrowArray> dictionary;
+  std::vector<std::shared_ptr<const void>> owners;
+
+  ~ExportedArray() {
+    for (const auto& child : children) {
+      if (child->release) {
+        child->release(child.get());
+      }
+    }
+    if (dictionary && dictionary->release) {
+      dictionary->release(dictionary.get());
+    }
+  }
+};
+
+void release_array(ArrowArray* array) {
+  delete static_cast<ExportedArray*>(array->private_data);
+  array->release = nullptr;
+}
+
+ExportedArray& initialize_array(ArrowArray& array, const int64_t length) {
+  auto* exported_array = new ExportedArray{};
+  array = ArrowArray{length, 0, 0, 0, 0, nullptr, nullptr, nullptr, &release_array, exported_array};
+  return *exported_array;
+}
+
+void set_buffers(ArrowArray& array, std::vector<const void*>&& buffers) {
+  auto& exported_array = *static_cast<ExportedArray*>(array.private_data);
+  exported_array.buffers = std::move(buffers);
+  array.n_buffers = static_cast<int64_t>(exported_array.buffers.size());
+  array.buffers = exported_array.buffers.data();
+}
+
+ArrowArray& add_child(ArrowArray& array) {
+  auto& exported_array = *static_cast<ExportedArray*>(array.private_data);
+  exported_array.children.emplace_back(std::make_unique<ArrowArray>());
+  exported_array.child_pointers.emplace_back(exported_array.children.back().get());
+  array.n_children = static_cast<int64_t>(exported_array.child_pointers.size());
+  array.children = exported_array.child_pointers.data();
+  return *exported_array.children.back();
+}
+
+ArrowArray& add_dictionary(ArrowArray& array) {
+  auto& exported_array = *static_cast<ExportedArray*>(array.private_data);
+  exported_array.dictionary = std::make_unique<ArrowArray>();
+  array.dictionary = exported_array.dictionary.get();
+  return *array.dictionary;
+}
+
+// Moves a buffer into the exported array and returns a pointer to its data.
+template <typename U>
+const U* own_buffer(ArrowArray& array, std::vector<U>&& buffer) {
+  const auto owned_buffer = std::make_shared<const std::vector<U>>(std::move(buffer));
+  static_cast<ExportedArray*>(array.private_data)->owners.emplace_back(owned_buffer);
+  return owned_buffer->data();
+}
+
+// Arrow marks valid rows with a set bit, whereas NullBitmap marks NULL rows. Returns nullptr if no row is NULL.
+const void* export_validity(ArrowArray& array, const NullBitmap& null_values) {
+  array.null_count = static_cast<int64_t>(null_values.count());
+  if (array.null_count == 0) {
+    return nullptr;
+  }
+  auto validity = std::vector<uint64_t>(null_values.words().size());
+  std::transform(null_values.words().begin(), null_values.words().end(), validity.begin(),
+                 [](const auto word) { return ~word; });
+  return own_buffer(array, std::move(validity));
+}
+
+// Exports the values of a ValueSegment or ExternalSegment of a fixed-width type without copying them.
+template <typename Segment>
+void export_plain_values(ArrowArray& array, const std::shared_ptr<const Segment>& segment) {
+  auto& exported_array = initialize_array(array, segment->size());
+  exported_array.owners.emplace_back(segment);
+  const auto* validity = segment->is_nullable() ? export_validity(array, segment->null_values()) : nullptr;
+  set_buffers(array, {validity, segment->values().data()});
+}
+
+// Copies values into new buffers. value_at(offset) returns an optional value, which is std::nullopt for NULL rows.
+template <typename T, typename ValueAt>
+void export_copied_values(ArrowArray& array, const size_t size, const ValueAt& value_at) {
+  initialize_array(array, static_cast<int64_t>(size));
+  auto null_values = NullBitmap{size};
+  auto offsets = std::vector<int32_t>{0};
+  auto characters = std::vector<char>{};
+  auto values = std::vector<T>{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    offsets.reserve(size + 1);
+  } else {
+    values.resize(size);
+  }
+
+  for (auto offset = size_t{0}; offset < size; ++offset) {
+    const auto value = value_at(offset);
+    if (!value) {
+      null_values.set(offset, true);
+    }
+    if constexpr (std::is_same_v<T, std::string>) {
+      if (value) {
+        const auto view = std::string_view{*value};
+        characters.insert(characters.end(), view.begin(), view.end());
+        Assert(characters.size() <= std::numeric_limits<int32_t>::max(), "Strings exceed 2 GB of characters.");
+      }
+      offsets.emplace_back(static_cast<int32_t>(characters.size()));
+    } else if (value) {
+      values[offset] = *value;
+    }
+  }
+
+  const auto* validity = export_validity(array, null_values);
+  if constexpr (std::is_same_v<T, std::string>) {
+    set_buffers(array, {validity, own_buffer(array, std::move(offsets)), own_buffer(array, std::move(characters))});
+  } else {
+    set_buffers(array, {validity, own_buffer(array, std::move(values))});
+  }
+}
+
+template <typename T>
+void export_dictionary_segment(ArrowSchema& schema, ArrowArray& array,
+                               const std::shared_ptr<const DictionarySegment<T>>& segment, const std::string& name,
+                               const int64_t flags) {
+  const auto& attribute_vector = *segment->attribute_vector();
+  const auto segment_size = attribute_vector.size();
+  initialize_array(array, static_cast<int64_t>(segment_size)).owners.emplace_back(segment);
+
+  // The value ids are decoded to find the NULL rows. Unless they are stored with a fixed width, which Arrow can read
+  // directly, the decoded value ids are exported.
+  auto null_values = NullBitmap{segment_size};
+  auto decoded_value_ids = std::vector<uint32_t>{};
+  const auto* fixed_width_value_ids = static_cast<const void*>(nullptr);
+  auto index_format = "I";
+  if (const auto* vector = dynamic_cast<const FixedWidthIntegerVector<uint8_t>*>(&attribute_vector)) {
+    fixed_width_value_ids = vector->values().data();
+    index_format = "C";
+  } else if (const auto* vector = dynamic_cast<const FixedWidthIntegerVector<uint16_t>*>(&attribute_vector)) {
+    fixed_width_value_ids = vector->values().data();
+    index_format = "S";
+  } else if (const auto* vector = dynamic_cast<const FixedWidthIntegerVector<uint32_t>*>(&attribute_vector)) {
+    fixed_width_value_ids = vector->values().data();
+  } else {
+    decoded_value_ids.reserve(segment_size);
+  }
+
+  const auto null_value_id = segment->null_value_id();
+  auto value_ids = std::vector<ValueID>{};
+  for (auto begin = size_t{0}; begin < segment_size; begin += DECODE_BLOCK_SIZE) {
+    const auto end = std::min(begin + DECODE_BLOCK_SIZE, segment_size);
+    value_ids.clear();
+    attribute_vector.decode_range(begin, end, value_ids);
+    for (auto index = size_t{0}; index < value_ids.size(); ++index) {
+      if (value_ids[index] == null_value_id) {
+        null_values.set(begin + index, true);
+      }
+      if (!fixed_width_value_ids) {
+        decoded_value_ids.emplace_back(value_ids[index]);
+      }
+    }
+  }
+  const auto* validity = export_validity(array, null_values);
+  if (!fixed_width_value_ids) {
+    fixed_width_value_ids = own_buffer(array, std::move(decoded_value_ids));
+  }
+  set_buffers(array, {validity, fixed_width_value_ids});
+
+  // The dictionary is sorted, so the order of the value ids matches the order of the values.
+  initialize_schema(schema, index_format, name, flags | ARROW_FLAG_DICTIONARY_ORDERED);
+  initialize_schema(add_dictionary(schema), arrow_format<T>(), "", 0);
+  auto& dictionary_array = add_dictionary(array);
+  const auto& dictionary = segment->dictionary();
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (dictionary.is_compressed()) {
+      export_copied_values<T>(dictionary_array, dictionary.size(),
+                              [&](const auto index) { return std::optional<std::string>{dictionary.get(index)}; });
+      return;
+    }
+    Assert(dictionary.characters().size() <= std::numeric_limits<int32_t>::max(),
+           "Dictionary exceeds 2 GB of characters.");
+    // The uint32_t offsets of the dictionary have the same representation as Arrow's int32_t offsets.
+    initialize_array(dictionary_array, static_cast<int64_t>(dictionary.size())).owners.emplace_back(segment);
+    set_buffers(dictionary_array, {nullptr, dictionary.offsets().data(), dictionary.characters().data()});
+  } else {
+    initialize_array(dictionary_array, static_cast<int64_t>(dictionary.size())).owners.emplace_back(segment);
+    set_buffers(dictionary_array, {nullptr, dictionary.data()});
+  }
+}
+
+template <typename T>
+void export_segment(ArrowSchema& schema, ArrowArray& array, const std::shared_ptr<const AbstractSegment>& segment,
+                    const std::string& name, const bool nullable) {
+  const auto flags = nullable ? int64_t{ARROW_FLAG_NULLABLE} : int64_t{0};
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+    return export_dictionary_segment(schema, array, dictionary_segment, name, flags);
+  }
+
+  initialize_schema(schema, arrow_format<T>(), name, flags);
+  const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment);
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (value_segment) {
+      const auto& values = value_segment->values();
+      return export_copied_values<T>(array, value_segment->size(), [&](const auto offset) {
+        return value_segment->is_null(offset) ? std::nullopt : std::optional<std::string_view>{values[offset]};
+      });
+    }
+  } else {
+    if (value_segment) {
+      return export_plain_values(array, value_segment);
+    }
+    if (const auto external_segment = std::dynamic_pointer_cast<const ExternalSegment<T>>(segment)) {
+      return export_plain_values(array, external_segment);
+    }
+  }
+
+  // All other segment types are materialized with their typed iterators first.
+  auto values = std::vector<std::optional<T>>(segment->size());
+  segment_iterate<T>(*segment, [&](const auto& position) {
+    if (!position.is_null()) {
+      values[position.chunk_offset()] = T{position.value()};
+    }
+  });
+  export_copied_values<T>(array, values.size(), [&](const auto offset) { return values[offset]; });
+}
+
+// Reads the validity bitmap of the rows [begin, begin + length) of an array. Returns std::nullopt for columns that are
+// not nullable, which must not contain NULL values.
+std::optional<NullBitmap> import_validity(const ArrowArray& array, const int64_t begin, const int64_t length,
+                                          const bool nullable) {
+  auto null_values = NullBitmap{static_cast<size_t>(length)};
+  const auto* validity = array.n_buffers > 0 ? static_cast<const uint8_t*>(array.buffers[0]) : nullptr;
+  if (validity && array.null_count != 0) {
+    for (auto index = int64_t{0}; index < length; ++index) {
+      const auto position = array.offset + begin + index;
+      if (!((validity[position / 8] >> (position % 8)) & 1)) {
+        null_values.set(index, true);
+      }
+    }
+  }
+
+  if (!nullable) {
+    Assert(null_values.count() == 0, "Trying to import NULL values into a not nullable column.");
+    return std::nullopt;
+  }
+  return null_values;
+}
+
+// Returns a functor that reads the value at a given index of an array that is not dictionary-encoded.
+template <typename T>
+auto make_value_reader(const ArrowArray& array) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto* offsets = static_cast<const int32_t*>(array.buffers[1]) + array.offset;
+    const auto* characters = static_cast<const char*>(array.buffers[2]);
+    return [offsets, characters](const int64_t index) {
+      return std::string_view{characters + offsets[index], static_cast<size_t>(offsets[index + 1] - offsets[index])};
+    };
+  } else {
+    const auto* values = static_cast<const T*>(array.buffers[1]) + array.offset;
+    return [values](const int64_t index) { return values[index]; };
+  }
+}
+
+// Passes a value of the integer type that a dictionary index format describes on to a generic lambda.
+template <typename Functor>
+void resolve_index_type(const std::string_view format, const Functor& func) {
+  if (format == "c") return func(int8_t{});    // NOLINT(readability/braces)
+  if (format == "C") return func(uint8_t{});   // NOLINT(readability/braces)
+  if (format == "s") return func(int16_t{});   // NOLINT(readability/braces)
+  if (format == "S") return func(uint16_t{});  // NOLINT(readability/braces)
+  if (format == "i") return func(int32_t{});   // NOLINT(readability/braces)
+  if (format == "I") return func(uint32_t{});  // NOLINT(readability/braces)
+  if (format == "l") return func(int64_t{});   // NOLINT(readability/braces)
+  if (format == "L") return func(uint64_t{});  // NOLINT(readability/braces)
+  Fail("Unsupported Arrow dictionary index format '" + std::string{format} + "'.");
+}
+
+template <typename T>
+std::shared_ptr<AbstractSegment> import_column(const ArrowSchema& schema, const ArrowArray& array,
+                                               const std::shared_ptr<const ArrowArray>& batch, const int64_t begin,
+                                               const int64_t length, const bool nullable) {
+  Assert(begin + length <= array.length, "Arrow array is shorter than the record batch.");
+  auto null_values = import_validity(array, begin, length, nullable);
+  const auto is_null = [&](const int64_t index) { return null_values && (*null_values)[index]; };
+
+  if (schema.dictionary) {
+    Assert(std::string_view{schema.dictionary->format} == arrow_format<T>(), "Arrow format does not match the column.");
+    // Dictionary-encoded columns are decoded, as the Arrow dictionary is neither sorted nor free of duplicates in
+    // general.
+    const auto read_value = make_value_reader<T>(*array.dictionary);
+    auto values = std::vector<T>(length);
+    resolve_index_type(schema.format, [&](const auto index_type) {
+      using IndexType = decltype(index_type);
+      const auto* indices = static_cast<const IndexType*>(array.buffers[1]) + array.offset + begin;
+      for (auto index = int64_t{0}; index < length; ++index) {
+        if (!is_null(index)) {
+          values[index] = T{read_value(static_cast<int64_t>(indices[index]))};
+        }
+      }
+    });
+    return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  }
+
+  Assert(std::string_view{schema.format} == arrow_format<T>(), "Arrow format does not match the column.");
+  const auto read_value = make_value_reader<T>(array);
+  if constexpr (std::is_arithmetic_v<T>) {
+    // Aligned buffers are adopted without copying. The segment keeps the whole batch alive.
+    const auto* values = static_cast<const T*>(array.buffers[1]) + array.offset + begin;
+    if (reinterpret_cast<uintptr_t>(values) % alignof(T) == 0) {
+      return std::make_shared<ExternalSegment<T>>(std::span{values, static_cast<size_t>(length)}, batch,
+                                                  std::move(null_values));
+    }
+  }
+  auto values = std::vector<T>(length);
+  for (auto index = int64_t{0}; index < length; ++index) {
+    if (!is_null(index)) {
+      values[index] = T{read_value(begin + index)};
+    }
+  }
+  return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+}
+
+}  // namespace
+
+namespace opossum {
+
+void export_chunk_to_arrow(const std::shared_ptr<const Table>& table, const ChunkID chunk_id, ArrowSchema* schema,
+                           ArrowArray* array) {
+  const auto chunk = table->get_chunk(chunk_id);
+  initialize_schema(*schema, "+s", "", 0);
+  initialize_array(*array, chunk->size());
+  set_buffers(*array, {nullptr});
+
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    auto& child_schema = add_child(*schema);
+    auto& child_array = add_child(*array);
+    resolve_data_type(table->column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      export_segment<ColumnDataType>(child_schema, child_array, chunk->get_segment(column_id),
+                                     table->column_name(column_id), table->column_nullable(column_id));
+    });
+  }
+}
+
+std::shared_ptr<Table> create_table_from_arrow_schema(const ArrowSchema& schema, const ChunkOffset target_chunk_size) {
+  Assert(std::string_view{schema.format} == "+s", "Arrow schema does not describe a record batch.");
+  const auto table = std::make_shared<Table>(target_chunk_size);
+  for (auto column_id = int64_t{0}; column_id < schema.n_children; ++column_id) {
+    const auto& column_schema = *schema.children[column_id];
+    const auto& value_schema = column_schema.dictionary ? *column_schema.dictionary : column_schema;
+    table->add_column(column_schema.name ? column_schema.name : "", data_type_of_arrow_format(value_schema.format),
+                      column_schema.flags & ARROW_FLAG_NULLABLE);
+  }
+  return table;
+}
+
+void append_arrow_record_batch(Table& table, const ArrowSchema& schema, ArrowArray* array) {
+  Assert(array->release, "Arrow array has already been released.");
+  // Moving the array marks the caller's structure as released. The batch is released with the last segment that
+  // references it.
+  const auto batch = std::shared_ptr<ArrowArray>(new ArrowArray{*array}, [](ArrowArray* moved_array) {
+    if (moved_array->release) {
+      moved_array->release(moved_array);
+    }
+    delete moved_array;
+  });
+  array->release = nullptr;
+
+  const auto column_count = table.column_count();
+  Assert(schema.n_children == column_count && batch->n_children == column_count,
+         "Record batch does not match the table.");
+  Assert(batch->null_count == 0 || batch->n_buffers == 0 || !batch->buffers[0],
+         "Record batches must not contain NULL rows.");
+
+  const auto target_chunk_size = static_cast<int64_t>(table.target_chunk_size());
+  for (auto begin = int64_t{0}; begin < batch->length; begin += target_chunk_size) {
+    const auto length = std::min(target_chunk_size, batch->length - begin);
+    auto segments = std::vector<std::shared_ptr<AbstractSegment>>{};
+    segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        segments.emplace_back(import_column<ColumnDataType>(*schema.children[column_id], *batch->children[column_id],
+                                                            batch, batch->offset + begin, length,
+                                                            table.column_nullable(column_id)));
+      });
+    }
+    table.append_chunk(segments);
+  }
+}
+
+}  // namespace opossum
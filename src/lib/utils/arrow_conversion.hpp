@@ -0,0 +1,32 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+
+#include "types.hpp"
+#include "utils/arrow_c_data_interface.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Exports a chunk as an Arrow record batch, i.e., a struct array with one child per column, through the Arrow C Data
+// Interface. Fixed-width ValueSegments and ExternalSegments are exported without copying their values.
+// DictionarySegments become dictionary-encoded arrays that share the dictionary and, for fixed-width attribute vectors,
+// the value ids. Strings in ValueSegments and all other segment types are copied. As the schema depends on the encoding
+// of the segments, it is exported per chunk. Until both structures are released, they keep the segments alive, which
+// must not be appended to in the meantime.
+void export_chunk_to_arrow(const std::shared_ptr<const Table>& table, const ChunkID chunk_id, ArrowSchema* schema,
+                           ArrowArray* array);
+
+// Creates an empty table with the columns described by the schema of a record batch.
+std::shared_ptr<Table> create_table_from_arrow_schema(
+    const ArrowSchema& schema, const ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
+
+// Appends a record batch with the given schema to a table with matching columns. The batch is moved out of array and
+// released once no segment references it anymore. Fixed-width columns become ExternalSegments that reference the Arrow
+// buffers without copying. Strings and dictionary-encoded columns are decoded into ValueSegments. Batches larger than
+// the target chunk size are split into several chunks.
+void append_arrow_record_batch(Table& table, const ArrowSchema& schema, ArrowArray* array);
+
+}  // namespace opossum
@@ -0,0 +1,546 @@
+#include "binary_table.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "statistics/segment_statistics.hpp"
+#include "storage/bit_packed_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/external_segment.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_symbol_table.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+static_assert(std::endian::native == std::endian::little, "The binary table format requires a little-endian machine.");
+
+constexpr auto MAGIC = std::string_view{"OPOSSUMT", 8};
+constexpr auto FORMAT_VERSION = uint32_t{1};
+constexpr auto ALIGNMENT = size_t{8};
+
+enum class SegmentEncoding : uint8_t { Unencoded, Dictionary, RunLength, FrameOfReference };
+
+enum class AttributeVectorEncoding : uint8_t { FixedWidthInteger, BitPacked };
+
+// Writes values in native byte order and keeps track of the position, so that arrays can be aligned.
+class BinaryWriter : private Noncopyable {
+ public:
+  explicit BinaryWriter(const std::string& file_name) : _stream(file_name, std::ios::binary | std::ios::trunc) {
+    Assert(_stream.is_open(), "Could not open file " + file_name);
+  }
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written.");
+    _write_bytes(&value, sizeof(T));
+  }
+
+  // Writes the number of elements, followed by the aligned elements.
+  template <typename T>
+  void write_array(const std::span<const T> values) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only arrays of trivially copyable values can be written.");
+    write(uint64_t{values.size()});
+    align();
+    _write_bytes(values.data(), values.size_bytes());
+  }
+
+  void write_string(const std::string_view value) {
+    write(uint64_t{value.size()});
+    _write_bytes(value.data(), value.size());
+  }
+
+  // Writes a list of strings as one array of end offsets and one array of characters.
+  template <typename Strings>
+  void write_strings(const Strings& strings) {
+    auto offsets = std::vector<uint64_t>{};
+    offsets.reserve(strings.size());
+    auto characters = std::vector<char>{};
+    for (auto index = size_t{0}; index < strings.size(); ++index) {
+      const auto value = std::string_view{strings[index]};
+      characters.insert(characters.end(), value.begin(), value.end());
+      offsets.emplace_back(characters.size());
+    }
+    write_array(std::span<const uint64_t>{offsets});
+    write_array(std::span<const char>{characters});
+  }
+
+  void align() {
+    static constexpr auto PADDING = std::array<char, ALIGNMENT>{};
+    _write_bytes(PADDING.data(), (ALIGNMENT - _position % ALIGNMENT) % ALIGNMENT);
+  }
+
+  uint64_t position() const {
+    return _position;
+  }
+
+  void finish() {
+    _stream.flush();
+    Assert(_stream.good(), "Could not write binary table.");
+  }
+
+ protected:
+  void _write_bytes(const void* data, const size_t size) {
+    _stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    _position += size;
+  }
+
+  std::ofstream _stream;
+  uint64_t _position{0};
+};
+
+// Reads what BinaryWriter wrote from a memory-mapped file. Every read is bounds-checked, so corrupted files lead to
+// exceptions instead of invalid memory accesses. If the mapping is given, buffers are not copied but refer to the
+// mapped file, which they keep alive.
+class BinaryReader {
+ public:
+  BinaryReader(const std::string_view data, const uint64_t position,
+               const std::shared_ptr<const MemoryMappedFile>& mapping = nullptr)
+      : _data(data), _position(position), _mapping(mapping) {}
+
+  template <typename T>
+  T read() {
+    auto value = T{};
+    std::memcpy(&value, _read_bytes(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  // Returns a view on an aligned array without copying it. It is valid as long as the file is mapped.
+  template <typename T>
+  std::span<const T> read_span() {
+    const auto size = read<uint64_t>();
+    _position += (ALIGNMENT - _position % ALIGNMENT) % ALIGNMENT;
+    Assert(size <= _data.size() / sizeof(T), "Array exceeds the file.");
+    const auto* data = _read_bytes(size * sizeof(T));
+    // The file is mapped at a page boundary and all arrays are aligned, so we can access the elements directly.
+    return {reinterpret_cast<const T*>(data), size};
+  }
+
+  // Copies an aligned array into a new vector.
+  template <typename T>
+  std::vector<T> read_array() {
+    const auto values = read_span<T>();
+    return std::vector<T>(values.begin(), values.end());
+  }
+
+  // Reads an aligned array into a buffer, which refers to the mapped file if there is one.
+  template <typename T>
+  Buffer<T> read_buffer() {
+    if (_mapping) {
+      return Buffer<T>{read_span<T>(), _mapping};
+    }
+    return Buffer<T>{read_array<T>()};
+  }
+
+  const std::shared_ptr<const MemoryMappedFile>& mapping() const {
+    return _mapping;
+  }
+
+  std::string read_string() {
+    const auto size = read<uint64_t>();
+    Assert(size <= _data.size(), "String exceeds the file.");
+    return std::string{_read_bytes(size), size};
+  }
+
+  // Reads a list of strings and calls function with a view on each of them.
+  template <typename Function>
+  void read_strings(const Function& function) {
+    const auto offsets = read_span<uint64_t>();
+    const auto characters = read_span<char>();
+    auto begin = uint64_t{0};
+    for (const auto end : offsets) {
+      Assert(begin <= end && end <= characters.size(), "Invalid string offsets.");
+      function(std::string_view{characters.data() + begin, end - begin});
+      begin = end;
+    }
+  }
+
+ protected:
+  const char* _read_bytes(const size_t size) {
+    Assert(_position <= _data.size() && size <= _data.size() - _position, "Unexpected end of binary table.");
+    const auto* data = _data.data() + _position;
+    _position += size;
+    return data;
+  }
+
+  const std::string_view _data;
+  uint64_t _position;
+  const std::shared_ptr<const MemoryMappedFile> _mapping;
+};
+
+void write_null_values(BinaryWriter& writer, const NullBitmap* null_values) {
+  writer.write(static_cast<uint8_t>(null_values != nullptr));
+  if (null_values) {
+    writer.write(uint64_t{null_values->size()});
+    writer.write_array(std::span<const uint64_t>{null_values->words()});
+  }
+}
+
+std::optional<NullBitmap> read_null_values(BinaryReader& reader) {
+  if (!reader.read<uint8_t>()) {
+    return std::nullopt;
+  }
+  const auto size = reader.read<uint64_t>();
+  return NullBitmap{reader.read_array<uint64_t>(), size};
+}
+
+void write_bit_packed_vector(BinaryWriter& writer, const BitPackedVector& vector) {
+  writer.write(vector.bit_width());
+  writer.write(uint64_t{vector.size()});
+  writer.write_array(std::span<const uint64_t>{vector.words()});
+}
+
+std::shared_ptr<BitPackedVector> read_bit_packed_vector(BinaryReader& reader) {
+  const auto bit_width = reader.read<uint8_t>();
+  const auto size = reader.read<uint64_t>();
+  return std::make_shared<BitPackedVector>(reader.read_buffer<uint64_t>(), size, bit_width);
+}
+
+void write_attribute_vector(BinaryWriter& writer, const AbstractAttributeVector& attribute_vector) {
+  if (const auto* bit_packed_vector = dynamic_cast<const BitPackedVector*>(&attribute_vector)) {
+    writer.write(AttributeVectorEncoding::BitPacked);
+    write_bit_packed_vector(writer, *bit_packed_vector);
+    return;
+  }
+  writer.write(AttributeVectorEncoding::FixedWidthInteger);
+  writer.write(attribute_vector.width());
+  switch (attribute_vector.width()) {
+    case 1:
+      writer.write_array(std::span{dynamic_cast<const FixedWidthIntegerVector<uint8_t>&>(attribute_vector).values()});
+      break;
+    case 2:
+      writer.write_array(std::span{dynamic_cast<const FixedWidthIntegerVector<uint16_t>&>(attribute_vector).values()});
+      break;
+    case 4:
+      writer.write_array(std::span{dynamic_cast<const FixedWidthIntegerVector<uint32_t>&>(attribute_vector).values()});
+      break;
+    default:
+      Fail("Unsupported attribute vector width.");
+  }
+}
+
+std::shared_ptr<AbstractAttributeVector> read_attribute_vector(BinaryReader& reader) {
+  if (reader.read<AttributeVectorEncoding>() == AttributeVectorEncoding::BitPacked) {
+    return read_bit_packed_vector(reader);
+  }
+  switch (reader.read<AttributeVectorWidth>()) {
+    case 1:
+      return std::make_shared<FixedWidthIntegerVector<uint8_t>>(reader.read_buffer<uint8_t>());
+    case 2:
+      return std::make_shared<FixedWidthIntegerVector<uint16_t>>(reader.read_buffer<uint16_t>());
+    case 4:
+      return std::make_shared<FixedWidthIntegerVector<uint32_t>>(reader.read_buffer<uint32_t>());
+    default:
+      Fail("Unsupported attribute vector width.");
+  }
+}
+
+template <typename Values>
+void write_values(BinaryWriter& writer, const Values& values) {
+  if constexpr (std::is_same_v<Values, GermanStringVector> || std::is_same_v<Values, std::vector<std::string>>) {
+    writer.write_strings(values);
+  } else {
+    writer.write_array(std::span{values});
+  }
+}
+
+template <typename T>
+std::vector<T> read_values(BinaryReader& reader) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto values = std::vector<std::string>{};
+    reader.read_strings([&](const auto value) { values.emplace_back(value); });
+    return values;
+  } else {
+    return reader.read_array<T>();
+  }
+}
+
+template <typename T>
+void write_segment(BinaryWriter& writer, const AbstractSegment& segment) {
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    writer.write(SegmentEncoding::Unencoded);
+    write_null_values(writer, value_segment->is_nullable() ? &value_segment->null_values() : nullptr);
+    write_values(writer, value_segment->values());
+    return;
+  }
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    // External segments are written like value segments. Their buffer is not referenced by the file.
+    if (const auto* external_segment = dynamic_cast<const ExternalSegment<T>*>(&segment)) {
+      writer.write(SegmentEncoding::Unencoded);
+      write_null_values(writer, external_segment->is_nullable() ? &external_segment->null_values() : nullptr);
+      writer.write_array(external_segment->values());
+      return;
+    }
+  }
+
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    writer.write(SegmentEncoding::Dictionary);
+    const auto& dictionary = dictionary_segment->dictionary();
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto symbol_table = dictionary.symbol_table();
+      writer.write(static_cast<uint8_t>(symbol_table != nullptr));
+      if (symbol_table) {
+        writer.write(uint64_t{symbol_table->symbol_count()});
+        for (auto code = size_t{0}; code < symbol_table->symbol_count(); ++code) {
+          writer.write_string(symbol_table->symbol(static_cast<uint8_t>(code)));
+        }
+      }
+      writer.write_array(std::span{dictionary.characters()});
+      writer.write_array(std::span{dictionary.offsets()});
+    } else {
+      writer.write_array(std::span{dictionary});
+    }
+    writer.write(dictionary_segment->null_value_id());
+    write_attribute_vector(writer, *dictionary_segment->attribute_vector());
+    return;
+  }
+
+  if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    writer.write(SegmentEncoding::RunLength);
+    write_values(writer, run_length_segment->values());
+    write_null_values(writer, &run_length_segment->null_values());
+    writer.write_array(std::span{run_length_segment->end_positions()});
+    return;
+  }
+
+  if constexpr (std::is_integral_v<T>) {
+    if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      writer.write(SegmentEncoding::FrameOfReference);
+      writer.write_array(std::span{frame_of_reference_segment->block_minima()});
+      write_bit_packed_vector(writer, *frame_of_reference_segment->offsets());
+      writer.write_array(std::span{frame_of_reference_segment->unencoded_blocks()});
+      writer.write_array(std::span{frame_of_reference_segment->unencoded_values()});
+      write_null_values(writer, frame_of_reference_segment->is_nullable() ? &frame_of_reference_segment->null_values()
+                                                                           : nullptr);
+      return;
+    }
+  }
+
+  Fail("Segment type is not supported by the binary table format.");
+}
+
+template <typename T>
+std::shared_ptr<AbstractSegment> read_segment(BinaryReader& reader) {
+  switch (reader.read<SegmentEncoding>()) {
+    case SegmentEncoding::Unencoded: {
+      auto null_values = read_null_values(reader);
+      if constexpr (std::is_same_v<T, std::string>) {
+        // The strings are copied from the file into the arena of the segment right away.
+        auto values = GermanStringVector{};
+        reader.read_strings([&](const auto value) { values.emplace_back(value); });
+        return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+      } else {
+        // Values in a mapped file are wrapped without copying them.
+        if (reader.mapping()) {
+          return std::make_shared<ExternalSegment<T>>(reader.read_span<T>(), reader.mapping(), std::move(null_values));
+        }
+        return std::make_shared<ValueSegment<T>>(reader.read_array<T>(), std::move(null_values));
+      }
+    }
+
+    case SegmentEncoding::Dictionary: {
+      auto dictionary = typename DictionarySegment<T>::Dictionary{};
+      if constexpr (std::is_same_v<T, std::string>) {
+        auto symbol_table = std::shared_ptr<FSSTSymbolTable>{};
+        if (reader.read<uint8_t>()) {
+          const auto symbol_count = reader.read<uint64_t>();
+          Assert(symbol_count <= FSSTSymbolTable::MAX_SYMBOL_COUNT, "Too many symbols.");
+          auto symbols = std::vector<std::string>(symbol_count);
+          for (auto& symbol : symbols) {
+            symbol = reader.read_string();
+          }
+          symbol_table = FSSTSymbolTable::from_symbols(symbols);
+        }
+        auto characters = reader.read_buffer<char>();
+        dictionary = StringDictionary{std::move(characters), reader.read_buffer<uint32_t>(), symbol_table};
+      } else {
+        dictionary = reader.read_buffer<T>();
+      }
+      const auto null_value_id = reader.read<ValueID>();
+      return std::make_shared<DictionarySegment<T>>(std::move(dictionary), read_attribute_vector(reader),
+                                                    null_value_id);
+    }
+
+    case SegmentEncoding::RunLength: {
+      auto values = read_values<T>(reader);
+      auto null_values = read_null_values(reader);
+      Assert(null_values, "Run-length segments need a NULL bitmap.");
+      return std::make_shared<RunLengthSegment<T>>(std::move(values), std::move(*null_values),
+                                                   reader.read_array<ChunkOffset>());
+    }
+
+    case SegmentEncoding::FrameOfReference: {
+      if constexpr (std::is_integral_v<T>) {
+        auto block_minima = reader.read_array<T>();
+        const auto offsets = read_bit_packed_vector(reader);
+        auto unencoded_blocks = reader.read_array<uint32_t>();
+        auto unencoded_values = reader.read_array<T>();
+        return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), offsets,
+                                                            std::move(unencoded_blocks), std::move(unencoded_values),
+                                                            read_null_values(reader));
+      }
+      Fail("Frame-of-reference encoding is only supported for int and long columns.");
+    }
+  }
+  Fail("Unknown segment encoding.");
+}
+
+// Describes where the segments of a chunk are stored.
+struct ChunkDescription {
+  ChunkOffset size{0};
+  bool has_statistics{false};
+  std::vector<uint64_t> segment_positions;
+};
+
+// Reads the segments of a chunk. Statistics are not recomputed for mapped files, as this would page in all segments.
+std::shared_ptr<Chunk> read_chunk(const Table& table, const std::string_view data,
+                                  const std::shared_ptr<const MemoryMappedFile>& mapping,
+                                  const ChunkDescription& description) {
+  const auto chunk = std::make_shared<Chunk>();
+  const auto compute_statistics = description.has_statistics && !mapping;
+  auto segment_statistics = std::vector<std::shared_ptr<const AbstractSegmentStatistics>>{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    auto reader = BinaryReader{data, description.segment_positions[column_id], mapping};
+    resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto segment = read_segment<ColumnDataType>(reader);
+      Assert(segment->size() == description.size, "Segment sizes do not match the chunk size.");
+      chunk->add_segment(segment);
+      if (compute_statistics) {
+        segment_statistics.emplace_back(std::make_shared<SegmentStatistics<ColumnDataType>>(*segment, true));
+      }
+    });
+  }
+  if (compute_statistics) {
+    chunk->set_segment_statistics(segment_statistics);
+  }
+  return chunk;
+}
+
+std::shared_ptr<Table> read_binary_table(const std::string& file_name, const bool keep_mapping) {
+  const auto file = std::make_shared<const MemoryMappedFile>(file_name);
+  const auto data = file->view();
+  const auto mapping = keep_mapping ? file : nullptr;
+
+  auto header_reader = BinaryReader{data, 0};
+  Assert(header_reader.read_string() == MAGIC, "File is not a binary table: " + file_name);
+  Assert(header_reader.read<uint32_t>() == FORMAT_VERSION, "Unsupported binary table version.");
+
+  // The file ends with the footer position and the magic string.
+  const auto trailer_size = sizeof(uint64_t) + sizeof(uint64_t) + MAGIC.size();
+  Assert(data.size() >= trailer_size, "Binary table is truncated.");
+  auto trailer_reader = BinaryReader{data, data.size() - trailer_size};
+  auto footer_reader = BinaryReader{data, trailer_reader.read<uint64_t>()};
+  Assert(trailer_reader.read_string() == MAGIC, "Binary table is truncated.");
+
+  const auto table = std::make_shared<Table>(footer_reader.read<ChunkOffset>());
+  const auto column_count = footer_reader.read<ColumnCount>();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto name = footer_reader.read_string();
+    const auto type = footer_reader.read_string();
+    table->add_column(name, type, footer_reader.read<uint8_t>());
+  }
+  const auto chunk_count = footer_reader.read<ChunkID>();
+  auto chunk_descriptions = std::vector<ChunkDescription>(chunk_count);
+  for (auto& description : chunk_descriptions) {
+    description.size = footer_reader.read<ChunkOffset>();
+    description.has_statistics = footer_reader.read<uint8_t>();
+    description.segment_positions = footer_reader.read_array<uint64_t>();
+    Assert(description.segment_positions.size() == column_count, "Every column needs a segment.");
+  }
+
+  // Each worker reconstructs every worker_count-th chunk. The chunks are independent, so they need no synchronization.
+  const auto worker_count = std::min(size_t{std::max(std::thread::hardware_concurrency(), 1u)}, size_t{chunk_count});
+  auto chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  auto workers = std::vector<std::future<void>>{};
+  workers.reserve(worker_count);
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    workers.emplace_back(std::async(std::launch::async, [&, worker_id]() {
+      for (auto chunk_id = worker_id; chunk_id < chunk_count; chunk_id += worker_count) {
+        chunks[chunk_id] = read_chunk(*table, data, mapping, chunk_descriptions[chunk_id]);
+      }
+    }));
+  }
+  for (auto& worker : workers) {
+    worker.get();
+  }
+
+  for (const auto& chunk : chunks) {
+    table->emplace_chunk(chunk);
+  }
+  return table;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void save_binary_table(const Table& table, const std::string& file_name) {
+  auto writer = BinaryWriter{file_name};
+  writer.write_string(MAGIC);
+  writer.write(FORMAT_VERSION);
+
+  const auto chunk_count = table.chunk_count();
+  const auto column_count = table.column_count();
+  auto chunk_descriptions = std::vector<ChunkDescription>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    auto& description = chunk_descriptions[chunk_id];
+    description.size = chunk->size();
+    description.has_statistics = column_count > 0 && chunk->get_segment_statistics(ColumnID{0}) != nullptr;
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      writer.align();
+      description.segment_positions.emplace_back(writer.position());
+      resolve_data_type(table.column_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        write_segment<ColumnDataType>(writer, *chunk->get_segment(column_id));
+      });
+    }
+  }
+
+  // The footer is written last, as it holds the positions of all segments.
+  writer.align();
+  const auto footer_position = writer.position();
+  writer.write(table.target_chunk_size());
+  writer.write(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    writer.write_string(table.column_name(column_id));
+    writer.write_string(table.column_type(column_id));
+    writer.write(static_cast<uint8_t>(table.column_nullable(column_id)));
+  }
+  writer.write(chunk_count);
+  for (const auto& description : chunk_descriptions) {
+    writer.write(description.size);
+    writer.write(static_cast<uint8_t>(description.has_statistics));
+    writer.write_array(std::span{description.segment_positions});
+  }
+  writer.write(footer_position);
+  writer.write_string(MAGIC);
+  writer.finish();
+}
+
+std::shared_ptr<Table> load_binary_table(const std::string& file_name) {
+  return read_binary_table(file_name, false);
+}
+
+std::shared_ptr<Table> map_binary_table(const std::string& file_name) {
+  return read_binary_table(file_name, true);
+}
+
+}  // namespace opossum
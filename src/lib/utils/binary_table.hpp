@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+// Writes a table to a binary file, chunk by chunk and segment by segment in their current encoding: value segments
+// (and external segments) with their NULL bitmaps, dictionary segments with their dictionary and attribute vector, as
+// well as run-length and frame-of-reference segments. A footer at the end of the file holds the column definitions and
+// the position of every segment. All arrays are stored 8-byte aligned in native (little-endian) byte order, so that
+// they can be copied into place, or used in place, when the file is memory-mapped. ReferenceSegments are not supported.
+void save_binary_table(const Table& table, const std::string& file_name);
+
+// Loads a table written by save_binary_table(). The chunks are reconstructed in parallel, without parsing or encoding
+// any values. Segment statistics are recomputed for chunks that had them, which is cheap for encoded segments.
+std::shared_ptr<Table> load_binary_table(const std::string& file_name);
+
+// Maps a table written by save_binary_table() without reading its segments. Values of unencoded numeric columns become
+// ExternalSegments, and dictionaries and attribute vectors of encoded segments refer to the mapped file, which the
+// operating system pages in on first access. Strings of value segments, NULL bitmaps, run-length segments, and the
+// block minima of frame-of-reference segments are still copied. No segment statistics are computed. The segments keep
+// the mapping alive, and the file must not be modified while it is mapped.
+std::shared_ptr<Table> map_binary_table(const std::string& file_name);
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <functional>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Returns the comparison functor of a ScanType that is known at compile time, e.g., for scan kernels that are
+// instantiated for every ScanType.
+template <ScanType scan_type>
+constexpr auto comparator_for() {
+  if constexpr (scan_type == ScanType::OpEquals) {
+    return std::equal_to<void>{};
+  } else if constexpr (scan_type == ScanType::OpNotEquals) {
+    return std::not_equal_to<void>{};
+  } else if constexpr (scan_type == ScanType::OpLessThan) {
+    return std::less<void>{};
+  } else if constexpr (scan_type == ScanType::OpLessThanEquals) {
+    return std::less_equal<void>{};
+  } else if constexpr (scan_type == ScanType::OpGreaterThan) {
+    return std::greater<void>{};
+  } else {
+    static_assert(scan_type == ScanType::OpGreaterThanEquals, "Unsupported scan type.");
+    return std::greater_equal<void>{};
+  }
+}
+
+// Resolves a ScanType to the matching comparison functor and passes it on to a generic lambda. This way, scan loops
+// can be written once and the comparison is fixed at compile time instead of being switched on for every row:
+//
+//   with_comparator(scan_type, [&](auto comparator) {
+//     for (...) {
+//       if (comparator(values[offset], search_value)) { ... }
+//     }
+//   });
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& func) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return func(comparator_for<ScanType::OpEquals>());
+    case ScanType::OpNotEquals:
+      return func(comparator_for<ScanType::OpNotEquals>());
+    case ScanType::OpLessThan:
+      return func(comparator_for<ScanType::OpLessThan>());
+    case ScanType::OpLessThanEquals:
+      return func(comparator_for<ScanType::OpLessThanEquals>());
+    case ScanType::OpGreaterThan:
+      return func(comparator_for<ScanType::OpGreaterThan>());
+    case ScanType::OpGreaterThanEquals:
+      return func(comparator_for<ScanType::OpGreaterThanEquals>());
+  }
+  Fail("Unsupported scan type.");
+}
+
+}  // namespace opossum
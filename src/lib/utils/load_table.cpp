@@ -1,15 +1,25 @@
 #include "load_table.hpp"
 
-#include <fstream>
-
-#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <charconv>
+#include <future>
+#include <semaphore>
+#include <sstream>
+#include <string_view>
+#include <thread>
 
 #include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/column_values.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_mapped_file.hpp"
 
 namespace {
 
+using namespace opossum;  // NOLINT(build/namespaces)
+
 std::vector<std::string> split(const std::string& str, char delimiter) {
   auto result = std::vector<std::string>{};
   auto stream = std::stringstream{str};
@@ -22,20 +32,134 @@ std::vector<std::string> split(const std::string& str, char delimiter) {
   return result;
 }
 
+// Returns the line starting at position and moves position to the start of the next line.
+std::string_view next_line(const std::string_view text, size_t& position) {
+  const auto line_end = std::min(text.find('\n', position), text.size());
+  const auto line = text.substr(position, line_end - position);
+  position = std::min(line_end + 1, text.size());
+  return line;
+}
+
+// Collects the parsed values of one column for one byte range of the file.
+class AbstractColumnParser : private Noncopyable {
+ public:
+  AbstractColumnParser() = default;
+  virtual ~AbstractColumnParser() = default;
+
+  virtual void parse(const std::string_view field) = 0;
+
+  // Returns the parsed values for Table::append_columns().
+  virtual std::shared_ptr<const AbstractColumnValues> finish_column_values() = 0;
+
+  // Returns the parsed values as a segment that adopts them without copying.
+  virtual std::shared_ptr<AbstractSegment> finish_segment() = 0;
+};
+
+template <typename T>
+class ColumnParser : public AbstractColumnParser {
+ public:
+  void parse(const std::string_view field) final {
+    if constexpr (std::is_same_v<T, std::string>) {
+      _values.emplace_back(field);
+    } else {
+      auto value = T{};
+      const auto* field_end = field.data() + field.size();
+      const auto [parse_end, error] = std::from_chars(field.data(), field_end, value);
+      Assert(error == std::errc{} && parse_end == field_end, "Could not parse value '" + std::string{field} + "'.");
+      _values.emplace_back(value);
+    }
+  }
+
+  std::shared_ptr<const AbstractColumnValues> finish_column_values() final {
+    return std::make_shared<ColumnValues<T>>(std::move(_values));
+  }
+
+  std::shared_ptr<AbstractSegment> finish_segment() final {
+    return std::make_shared<ValueSegment<T>>(std::move(_values));
+  }
+
+ protected:
+  std::vector<T> _values;
+};
+
+// Parses the lines of a byte range directly into typed column vectors. Empty lines are skipped.
+std::vector<std::unique_ptr<AbstractColumnParser>> parse_range(const std::string_view range,
+                                                               const std::vector<std::string>& column_types) {
+  const auto column_count = column_types.size();
+  auto parsers = std::vector<std::unique_ptr<AbstractColumnParser>>{};
+  parsers.reserve(column_count);
+  for (const auto& column_type : column_types) {
+    resolve_data_type(column_type, [&](auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      parsers.emplace_back(std::make_unique<ColumnParser<ColumnDataType>>());
+    });
+  }
+
+  for (auto position = size_t{0}; position < range.size();) {
+    const auto line = next_line(range, position);
+    if (line.empty()) {
+      continue;
+    }
+
+    auto field_begin = size_t{0};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      Assert(field_begin <= line.size(), "Mismatching number of values.");
+      const auto field_end = std::min(line.find('|', field_begin), line.size());
+      parsers[column_id]->parse(line.substr(field_begin, field_end - field_begin));
+      field_begin = field_end + 1;
+    }
+    Assert(field_begin == line.size() + 1, "Mismatching number of values.");
+  }
+  return parsers;
+}
+
+std::vector<std::shared_ptr<const AbstractColumnValues>> parse_range_into_column_values(
+    const std::string_view range, const std::vector<std::string>& column_types) {
+  auto columns = std::vector<std::shared_ptr<const AbstractColumnValues>>{};
+  for (const auto& parser : parse_range(range, column_types)) {
+    columns.emplace_back(parser->finish_column_values());
+  }
+  return columns;
+}
+
+// Returns the end of the byte range that starts at begin and holds the next row_count non-empty lines (or fewer, if
+// the text ends before).
+size_t find_range_end(const std::string_view text, const size_t begin, const size_t row_count) {
+  auto position = begin;
+  for (auto row = size_t{0}; row < row_count && position < text.size();) {
+    row += next_line(text, position).empty() ? 0 : 1;
+  }
+  return position;
+}
+
+// Releases a slot of a semaphore when it goes out of scope.
+class SemaphoreSlot : private Noncopyable {
+ public:
+  explicit SemaphoreSlot(std::counting_semaphore<>& semaphore) : _semaphore(semaphore) {}
+
+  ~SemaphoreSlot() {
+    _semaphore.release();
+  }
+
+ protected:
+  std::counting_semaphore<>& _semaphore;
+};
+
 }  // namespace
 
 namespace opossum {
 
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
-  auto infile = std::ifstream{file_name};
-  Assert(infile.is_open(), "load_table: Could not find file " + file_name);
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size,
+                                  const std::optional<EncodingType> encoding_type,
+                                  const size_t max_uncompressed_chunks) {
+  const auto file = MemoryMappedFile{file_name};
+  const auto text = file.view();
 
-  auto line = std::string{};
-  std::getline(infile, line);
-  const auto column_names = split(line, '|');
-  std::getline(infile, line);
-  const auto column_types = split(line, '|');
+  auto position = size_t{0};
+  const auto column_names = split(std::string{next_line(text, position)}, '|');
+  const auto column_types = split(std::string{next_line(text, position)}, '|');
 
+  Assert(chunk_size > 0, "Chunks need to hold at least one row.");
   const auto table = std::make_shared<Table>(chunk_size);
   const auto column_count = column_names.size();
   Assert(column_types.size() == column_count, "Mismatching number of column types.");
@@ -43,20 +167,72 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
     table->add_column(column_names[column_id], column_types[column_id], false);
   }
 
-  while (std::getline(infile, line)) {
-    const auto string_values = split(line, '|');
-    Assert(string_values.size() == column_count, "Mismatching number of values.");
-    auto variant_values = std::vector<AllTypeVariant>{};
-    variant_values.reserve(column_count);
+  const auto rows = text.substr(position);
+  if (encoding_type) {
+    // Streaming mode: every chunk is parsed and compressed on its own, and only compressed chunks are kept.
+    Assert(max_uncompressed_chunks > 0, "At least one uncompressed chunk needs to be allowed.");
+    // Every chunk is parsed and compressed by a job of the shared WorkerPool. Reading the file pauses while
+    // max_uncompressed_chunks jobs have not finished, so that the uncompressed values of at most that many chunks are
+    // alive at any time.
+    auto& worker_pool = WorkerPool::get();
+    auto free_slots = std::counting_semaphore<>{static_cast<std::ptrdiff_t>(max_uncompressed_chunks)};
+    auto compressed_chunks = std::vector<std::future<std::shared_ptr<Chunk>>>{};
+    for (auto range_begin = size_t{0}; range_begin < rows.size();) {
+      const auto range_end = find_range_end(rows, range_begin, chunk_size);
+      const auto range = rows.substr(range_begin, range_end - range_begin);
+      free_slots.acquire();
+      compressed_chunks.emplace_back(worker_pool.submit([&, range]() {
+        // Declared first, so the slot is freed after the uncompressed segments, also if parsing throws.
+        const auto slot = SemaphoreSlot{free_slots};
+        const auto chunk = std::make_shared<Chunk>();
+        for (const auto& parser : parse_range(range, column_types)) {
+          chunk->add_segment(parser->finish_segment());
+        }
+        return table->create_compressed_chunk(chunk, *encoding_type);
+      }));
+      range_begin = range_end;
+    }
 
-    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-      resolve_data_type(column_types[column_id], [&](auto data_type_t) {
-        using ColumnDataType = typename decltype(data_type_t)::type;
-        variant_values.emplace_back(boost::lexical_cast<ColumnDataType>(string_values[column_id]));
-      });
+    // The jobs reference free_slots, so all of them need to finish before an exception leaves this function.
+    for (const auto& compressed_chunk : compressed_chunks) {
+      worker_pool.wait(compressed_chunk);
+    }
+    for (auto& compressed_chunk : compressed_chunks) {
+      const auto chunk = compressed_chunk.get();
+      if (chunk->size() > 0) {
+        table->emplace_chunk(chunk);
+      }
+    }
+    // As after compress_chunk, subsequent appends go to a new chunk.
+    if (table->get_chunk(ChunkID{0})->size() > 0) {
+      table->create_new_chunk();
     }
+    return table;
+  }
+
+  // Split the rows into one byte range per hardware thread. Each range boundary is moved to the start of the next line,
+  // so ranges may be empty for tiny files.
+  const auto range_count = size_t{std::max(std::thread::hardware_concurrency(), 1u)};
+  auto range_boundaries = std::vector<size_t>{0};
+  for (auto range_id = size_t{1}; range_id < range_count; ++range_id) {
+    const auto line_end = rows.find('\n', std::max(rows.size() * range_id / range_count, range_boundaries.back()));
+    range_boundaries.emplace_back(line_end == std::string_view::npos ? rows.size() : line_end + 1);
+  }
+  range_boundaries.emplace_back(rows.size());
+
+  // The ranges are parsed asynchronously, so that exceptions are passed on to this thread.
+  auto parsed_ranges = std::vector<std::future<std::vector<std::shared_ptr<const AbstractColumnValues>>>>{};
+  parsed_ranges.reserve(range_count);
+  for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+    const auto range =
+        rows.substr(range_boundaries[range_id], range_boundaries[range_id + 1] - range_boundaries[range_id]);
+    parsed_ranges.emplace_back(
+        std::async(std::launch::async, parse_range_into_column_values, range, std::cref(column_types)));
+  }
 
-    table->append(variant_values);
+  // Append the ranges in file order.
+  for (auto& parsed_range : parsed_ranges) {
+    table->append_columns(parsed_range.get());
   }
   return table;
 }
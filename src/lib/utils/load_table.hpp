@@ -1,13 +1,29 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
+#include <thread>
+
+#include "types.hpp"
 
 namespace opossum {
 
 class Table;
 
-// This is a helper method which is heavily used in our test suite.
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size);
+// This is a helper method which is heavily used in our test suite. It loads a .tbl file, which holds the column names
+// in its first line, the column types in its second line, and one row per following line, with values separated by
+// '|'. The file is memory-mapped and split into byte ranges at line boundaries, which are parsed in parallel.
+//
+// If an encoding type is given, the file is loaded in streaming mode: each chunk is parsed and compressed on its own by
+// a job of the shared WorkerPool, and reading the file pauses while max_uncompressed_chunks chunks are not yet
+// compressed.
+// Thus, the uncompressed values of only a few chunks exist at any time, and peak memory usage follows the compressed
+// size of the table instead of its uncompressed size.
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size,
+                                  const std::optional<EncodingType> encoding_type = std::nullopt,
+                                  const size_t max_uncompressed_chunks =
+                                      std::max(std::thread::hardware_concurrency(), 1u));
 
 }  // namespace opossum
@@ -0,0 +1,52 @@
+#include "memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "assert.hpp"
+
+namespace opossum {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& file_name) {
+  const auto file_descriptor = open(file_name.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open file " + file_name);
+
+  struct stat file_status {};
+  if (fstat(file_descriptor, &file_status) != 0) {
+    close(file_descriptor);
+    Fail("Could not determine the size of file " + file_name);
+  }
+  _size = static_cast<size_t>(file_status.st_size);
+
+  // Mapping zero bytes is not allowed, so empty files are represented by a null pointer.
+  if (_size > 0) {
+    auto* mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    close(file_descriptor);
+    Assert(mapping != MAP_FAILED, "Could not map file " + file_name);
+    _data = static_cast<const char*>(mapping);
+    return;
+  }
+  close(file_descriptor);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (_data) {
+    munmap(const_cast<char*>(_data), _size);
+  }
+}
+
+const char* MemoryMappedFile::data() const {
+  return _data;
+}
+
+size_t MemoryMappedFile::size() const {
+  return _size;
+}
+
+std::string_view MemoryMappedFile::view() const {
+  return {_data, _size};
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Maps a file read-only into memory for the lifetime of the object. The operating system pages the file in on demand,
+// so opening even large files is cheap, and the pages can be shared by several threads.
+class MemoryMappedFile : private Noncopyable {
+ public:
+  explicit MemoryMappedFile(const std::string& file_name);
+  ~MemoryMappedFile();
+
+  // Returns the start of the mapping, which is nullptr for empty files.
+  const char* data() const;
+
+  // Returns the size of the file in bytes.
+  size_t size() const;
+
+  // Returns the whole file.
+  std::string_view view() const;
+
+ protected:
+  const char* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
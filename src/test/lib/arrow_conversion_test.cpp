@@ -0,0 +1,161 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/external_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/arrow_conversion.hpp"
+
+namespace opossum {
+
+class ArrowConversionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(5);
+    table->add_column("a", "int", true);
+    table->add_column("b", "string", true);
+    table->add_column("c", "double", false);
+    for (auto index = 0; index < 10; ++index) {
+      const auto string_value = index % 3 == 0 ? AllTypeVariant{NULL_VALUE}
+                                               : AllTypeVariant{"value number " + std::to_string(index % 4)};
+      table->append({index == 4 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index}, string_value, index * 1.5});
+    }
+  }
+
+  // Exports the chunk, imports it into a new table, and checks that both hold the same values.
+  void EXPECT_ROUND_TRIP(const ChunkID chunk_id) {
+    auto schema = ArrowSchema{};
+    auto array = ArrowArray{};
+    export_chunk_to_arrow(table, chunk_id, &schema, &array);
+    EXPECT_EQ(array.length, 5);
+
+    const auto imported_table = create_table_from_arrow_schema(schema);
+    EXPECT_EQ(imported_table->column_names(), table->column_names());
+    EXPECT_EQ(imported_table->column_type(ColumnID{1}), "string");
+    EXPECT_TRUE(imported_table->column_nullable(ColumnID{1}));
+    EXPECT_FALSE(imported_table->column_nullable(ColumnID{2}));
+    append_arrow_record_batch(*imported_table, schema, &array);
+    EXPECT_EQ(array.release, nullptr);
+    schema.release(&schema);
+
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto imported_chunk = imported_table->get_chunk(ChunkID{0});
+    ASSERT_EQ(imported_chunk->size(), chunk->size());
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      for (auto offset = ChunkOffset{0}; offset < chunk->size(); ++offset) {
+        const auto expected = (*chunk->get_segment(column_id))[offset];
+        const auto actual = (*imported_chunk->get_segment(column_id))[offset];
+        EXPECT_EQ(variant_is_null(actual), variant_is_null(expected));
+        if (!variant_is_null(expected)) {
+          EXPECT_EQ(actual, expected);
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(ArrowConversionTest, ExportValueSegmentsWithoutCopying) {
+  auto schema = ArrowSchema{};
+  auto array = ArrowArray{};
+  export_chunk_to_arrow(table, ChunkID{0}, &schema, &array);
+
+  EXPECT_EQ(std::string{schema.format}, "+s");
+  ASSERT_EQ(schema.n_children, 3);
+  EXPECT_EQ(std::string{schema.children[0]->format}, "i");
+  EXPECT_EQ(std::string{schema.children[0]->name}, "a");
+  EXPECT_EQ(schema.children[0]->flags, ARROW_FLAG_NULLABLE);
+  EXPECT_EQ(std::string{schema.children[1]->format}, "u");
+  EXPECT_EQ(schema.children[2]->flags, 0);
+
+  const auto int_segment =
+      std::dynamic_pointer_cast<ValueSegment<int32_t>>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  const auto& int_array = *array.children[0];
+  EXPECT_EQ(int_array.buffers[1], int_segment->values().data());
+  EXPECT_EQ(int_array.null_count, 1);
+  const auto* validity = static_cast<const uint8_t*>(int_array.buffers[0]);
+  EXPECT_EQ(validity[0] & 0x1F, 0x0F);
+
+  const auto& string_array = *array.children[1];
+  EXPECT_EQ(string_array.null_count, 2);
+  const auto* offsets = static_cast<const int32_t*>(string_array.buffers[1]);
+  const auto* characters = static_cast<const char*>(string_array.buffers[2]);
+  EXPECT_EQ(offsets[0], 0);
+  EXPECT_EQ(offsets[1], 0);
+  EXPECT_EQ(std::string(characters + offsets[1], offsets[2] - offsets[1]), "value number 1");
+
+  // The exported array keeps the segment alive.
+  table = nullptr;
+  EXPECT_EQ(static_cast<const int32_t*>(int_array.buffers[1])[3], 3);
+  array.release(&array);
+  schema.release(&schema);
+  EXPECT_EQ(array.release, nullptr);
+}
+
+TEST_F(ArrowConversionTest, ExportDictionarySegments) {
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, EncodingType::FSSTDictionary);
+
+  auto schema = ArrowSchema{};
+  auto array = ArrowArray{};
+  export_chunk_to_arrow(table, ChunkID{1}, &schema, &array);
+  const auto& string_schema = *schema.children[1];
+  EXPECT_EQ(std::string{string_schema.format}, "I");
+  ASSERT_TRUE(string_schema.dictionary);
+  EXPECT_EQ(std::string{string_schema.dictionary->format}, "u");
+  EXPECT_EQ(string_schema.flags, ARROW_FLAG_NULLABLE | ARROW_FLAG_DICTIONARY_ORDERED);
+  EXPECT_EQ(array.children[1]->dictionary->length, 3);
+  array.release(&array);
+  schema.release(&schema);
+
+  // Dictionaries with a fixed-width attribute vector are shared with Arrow.
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{7, 3, 7});
+  const auto dictionary_segment = std::make_shared<DictionarySegment<int32_t>>(value_segment);
+  auto dictionary_table = std::make_shared<Table>();
+  dictionary_table->add_column("a", "int", false);
+  dictionary_table->append_chunk({dictionary_segment});
+  export_chunk_to_arrow(dictionary_table, ChunkID{0}, &schema, &array);
+  EXPECT_EQ(std::string{schema.children[0]->format}, "C");
+  EXPECT_EQ(array.children[0]->dictionary->buffers[1], dictionary_segment->dictionary().data());
+  EXPECT_EQ(static_cast<const uint8_t*>(array.children[0]->buffers[1])[2], 1);
+  array.release(&array);
+  schema.release(&schema);
+
+  EXPECT_ROUND_TRIP(ChunkID{0});
+  EXPECT_ROUND_TRIP(ChunkID{1});
+}
+
+TEST_F(ArrowConversionTest, RoundTrip) {
+  EXPECT_ROUND_TRIP(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  EXPECT_ROUND_TRIP(ChunkID{1});
+}
+
+TEST_F(ArrowConversionTest, ImportWithoutCopying) {
+  auto schema = ArrowSchema{};
+  auto array = ArrowArray{};
+  export_chunk_to_arrow(table, ChunkID{0}, &schema, &array);
+  const auto* exported_doubles = array.children[2]->buffers[1];
+
+  // Batches are split into chunks of the target chunk size.
+  const auto imported_table = create_table_from_arrow_schema(schema, 2);
+  append_arrow_record_batch(*imported_table, schema, &array);
+  schema.release(&schema);
+  EXPECT_EQ(imported_table->row_count(), uint64_t{5});
+  EXPECT_EQ(imported_table->get_chunk(ChunkID{2})->size(), ChunkOffset{1});
+
+  const auto double_segment = std::dynamic_pointer_cast<ExternalSegment<double>>(
+      imported_table->get_chunk(ChunkID{1})->get_segment(ColumnID{2}));
+  ASSERT_TRUE(double_segment);
+  EXPECT_EQ(double_segment->values().data(), static_cast<const double*>(exported_doubles) + 2);
+  EXPECT_EQ(double_segment->get(1), 4.5);
+  const auto int_segment = std::dynamic_pointer_cast<ExternalSegment<int32_t>>(
+      imported_table->get_chunk(ChunkID{2})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(int_segment);
+  EXPECT_EQ(int_segment->get_typed_value(0), std::nullopt);
+
+  EXPECT_THROW(append_arrow_record_batch(*imported_table, schema, &array), std::logic_error);
+}
+
+}  // namespace opossum
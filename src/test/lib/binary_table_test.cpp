@@ -0,0 +1,178 @@
+#include <filesystem>
+#include <fstream>
+
+#include "base_test.hpp"
+
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/external_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/binary_table.hpp"
+
+namespace opossum {
+
+class BinaryTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    file_name = (std::filesystem::temp_directory_path() / "opossum_binary_table_test.bin").string();
+    table = std::make_shared<Table>(4);
+    table->add_column("a", "int", true);
+    table->add_column("b", "string", true);
+    table->add_column("c", "long", false);
+    table->add_column("d", "double", false);
+    for (auto index = 0; index < 18; ++index) {
+      const auto string_value = index % 5 == 0 ? AllTypeVariant{NULL_VALUE}
+                                               : AllTypeVariant{"a string that is long " + std::to_string(index % 3)};
+      table->append({index % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index / 2}, string_value,
+                     int64_t{index} * 1'000, index * 0.5});
+    }
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(file_name);
+  }
+
+  // Saves and loads (or maps) the table, and checks that the loaded table has the same chunks and values.
+  std::shared_ptr<Table> save_and_load(const bool map = false) {
+    save_binary_table(*table, file_name);
+    const auto loaded_table = map ? map_binary_table(file_name) : load_binary_table(file_name);
+    EXPECT_EQ(loaded_table->column_names(), table->column_names());
+    EXPECT_EQ(loaded_table->chunk_count(), table->chunk_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < std::min(table->chunk_count(), loaded_table->chunk_count());
+         ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto loaded_chunk = loaded_table->get_chunk(chunk_id);
+      EXPECT_EQ(loaded_chunk->size(), chunk->size());
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        for (auto offset = ChunkOffset{0}; offset < std::min(chunk->size(), loaded_chunk->size()); ++offset) {
+          const auto expected = (*chunk->get_segment(column_id))[offset];
+          const auto actual = (*loaded_chunk->get_segment(column_id))[offset];
+          EXPECT_EQ(variant_is_null(actual), variant_is_null(expected));
+          if (!variant_is_null(expected)) {
+            EXPECT_EQ(actual, expected);
+          }
+        }
+      }
+    }
+    return loaded_table;
+  }
+
+  std::string file_name;
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(BinaryTableTest, ValueSegments) {
+  const auto loaded_table = save_and_load();
+  EXPECT_EQ(loaded_table->target_chunk_size(), ChunkOffset{4});
+  EXPECT_EQ(loaded_table->column_names(), table->column_names());
+  EXPECT_TRUE(loaded_table->column_nullable(ColumnID{1}));
+  EXPECT_FALSE(loaded_table->column_nullable(ColumnID{2}));
+
+  // The loaded table can be appended to.
+  loaded_table->append({1, NULL_VALUE, int64_t{2}, 3.0});
+  EXPECT_EQ(loaded_table->row_count(), uint64_t{19});
+}
+
+TEST_F(BinaryTableTest, EncodedSegments) {
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, EncodingType::FSSTDictionary);
+  table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+  table->compress_chunk(ChunkID{4});
+
+  const auto loaded_table = save_and_load();
+
+  const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      loaded_table->get_chunk(ChunkID{1})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_TRUE(dictionary_segment->dictionary().is_compressed());
+  EXPECT_EQ(dictionary_segment->unique_values_count(), 2);
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int64_t>>(
+      loaded_table->get_chunk(ChunkID{2})->get_segment(ColumnID{2})));
+
+  // Statistics are only available for chunks that had them.
+  EXPECT_TRUE(loaded_table->get_chunk(ChunkID{0})->get_segment_statistics(ColumnID{1}));
+  EXPECT_FALSE(loaded_table->get_chunk(ChunkID{3})->get_segment_statistics(ColumnID{1}));
+
+  // Value IDs and the NULL value ID are restored as they were.
+  const auto original_segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+      table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  const auto loaded_segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+      loaded_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(loaded_segment);
+  EXPECT_EQ(loaded_segment->null_value_id(), original_segment->null_value_id());
+  EXPECT_EQ(loaded_segment->attribute_vector()->get(0), original_segment->attribute_vector()->get(0));
+  EXPECT_EQ(loaded_segment->dictionary(), original_segment->dictionary());
+}
+
+TEST_F(BinaryTableTest, FrameOfReferenceAndExternalSegments) {
+  auto int_table = std::make_shared<Table>(3);
+  int_table->add_column("a", "int", true);
+  int_table->add_column("b", "long", false);
+  // The long column spans more than 32 bits, so its block stays unencoded.
+  int_table->append({NULL_VALUE, int64_t{1} << 40});
+  int_table->append({7, int64_t{-5}});
+  int_table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  const auto values = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2});
+  const auto longs = std::make_shared<std::vector<int64_t>>(std::vector<int64_t>{3, 4});
+  int_table->append_chunk({std::make_shared<ExternalSegment<int32_t>>(std::span<const int32_t>{*values}, values),
+                           std::make_shared<ExternalSegment<int64_t>>(std::span<const int64_t>{*longs}, longs)});
+  table = int_table;
+
+  const auto loaded_table = save_and_load();
+  const auto loaded_segment = std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(
+      loaded_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(loaded_segment);
+  EXPECT_EQ(loaded_segment->get_typed_value(0), std::nullopt);
+  EXPECT_EQ(loaded_segment->get(1), 7);
+  const auto loaded_wide_segment = std::dynamic_pointer_cast<FrameOfReferenceSegment<int64_t>>(
+      loaded_table->get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(loaded_wide_segment);
+  EXPECT_EQ(loaded_wide_segment->unencoded_blocks(), std::vector<uint32_t>{0});
+  EXPECT_EQ(loaded_wide_segment->get(0), int64_t{1} << 40);
+  EXPECT_EQ(loaded_wide_segment->get(1), -5);
+  // External segments are loaded as value segments.
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(
+      loaded_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0})));
+}
+
+TEST_F(BinaryTableTest, MappedSegments) {
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, EncodingType::FSSTDictionary);
+
+  const auto mapped_table = save_and_load(true);
+  // The file can be removed, as the segments keep the mapping alive.
+  std::filesystem::remove(file_name);
+
+  const auto int_segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+      mapped_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(int_segment);
+  EXPECT_TRUE(int_segment->dictionary().is_external());
+  const auto string_segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      mapped_table->get_chunk(ChunkID{1})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(string_segment);
+  EXPECT_TRUE(string_segment->dictionary().characters().is_external());
+  EXPECT_EQ(string_segment->get(2), "a string that is long 0");
+  EXPECT_TRUE(std::dynamic_pointer_cast<ExternalSegment<double>>(
+      mapped_table->get_chunk(ChunkID{2})->get_segment(ColumnID{3})));
+  EXPECT_FALSE(mapped_table->get_chunk(ChunkID{0})->get_segment_statistics(ColumnID{0}));
+
+  // Mapped tables are regular tables for the storage manager.
+  auto& storage_manager = StorageManager::get();
+  storage_manager.add_table("mapped_table", mapped_table);
+  EXPECT_EQ(storage_manager.get_table("mapped_table")->row_count(), uint64_t{18});
+  storage_manager.drop_table("mapped_table");
+}
+
+TEST_F(BinaryTableTest, RejectInvalidFiles) {
+  std::ofstream{file_name} << "a|b\nint|float\n";
+  EXPECT_THROW(load_binary_table(file_name), std::logic_error);
+
+  save_binary_table(*table, file_name);
+  std::filesystem::resize_file(file_name, std::filesystem::file_size(file_name) - 1);
+  EXPECT_THROW(load_binary_table(file_name), std::logic_error);
+  EXPECT_THROW(load_binary_table("does_not_exist.bin"), std::logic_error);
+}
+
+}  // namespace opossum
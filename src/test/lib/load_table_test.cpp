@@ -0,0 +1,85 @@
+#include <filesystem>
+#include <fstream>
+
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class LoadTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    file_name = (std::filesystem::temp_directory_path() / "opossum_load_table_test.tbl").string();
+    expected_table = std::make_shared<Table>(7);
+    expected_table->add_column("a", "int", false);
+    expected_table->add_column("b", "string", false);
+    expected_table->add_column("c", "long", false);
+    expected_table->add_column("d", "double", false);
+
+    auto file = std::ofstream{file_name};
+    file << "a|b|c|d\nint|string|long|double\n";
+    for (auto index = 0; index < 1000; ++index) {
+      const auto string_value = "string number " + std::to_string(index % 13);
+      const auto long_value = int64_t{index} * 10'000'000'000;
+      file << -index << '|' << string_value << '|' << long_value << '|' << index << ".25\n";
+      expected_table->append({-index, string_value, long_value, index + 0.25});
+    }
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(file_name);
+  }
+
+  std::string file_name;
+  std::shared_ptr<Table> expected_table;
+};
+
+TEST_F(LoadTableTest, LoadFile) {
+  const auto table = load_table(file_name, 7);
+  EXPECT_EQ(table->column_names(), expected_table->column_names());
+  EXPECT_EQ(table->column_type(ColumnID{2}), "long");
+  EXPECT_EQ(table->chunk_count(), ChunkID{143});
+  EXPECT_EQ(table->get_chunk(ChunkID{142})->size(), ChunkOffset{6});
+  EXPECT_TABLE_EQ(table, expected_table, true);
+
+  // The last line does not need to end with a line break.
+  const auto fixture = load_table("src/test/tables/int_float.tbl", 2);
+  EXPECT_EQ(fixture->row_count(), uint64_t{3});
+  EXPECT_EQ((*fixture->get_chunk(ChunkID{1})->get_segment(ColumnID{1}))[0], AllTypeVariant{457.7f});
+}
+
+TEST_F(LoadTableTest, CompressWhileLoading) {
+  for (const auto max_uncompressed_chunks : {size_t{1}, size_t{3}}) {
+    const auto table = load_table(file_name, 100, EncodingType::Dictionary, max_uncompressed_chunks);
+    EXPECT_TABLE_EQ(table, expected_table, true);
+    // Subsequent appends go to a new, uncompressed chunk.
+    ASSERT_EQ(table->chunk_count(), ChunkID{11});
+    EXPECT_EQ(table->get_chunk(ChunkID{10})->size(), ChunkOffset{0});
+    for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{10}; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      EXPECT_EQ(chunk->size(), ChunkOffset{100});
+      EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<std::string>>(chunk->get_segment(ColumnID{1})));
+      EXPECT_TRUE(chunk->get_segment_statistics(ColumnID{3}));
+    }
+  }
+
+  const auto run_length_table = load_table(file_name, 300, EncodingType::RunLength);
+  EXPECT_TABLE_EQ(run_length_table, expected_table, true);
+  EXPECT_EQ(run_length_table->get_chunk(ChunkID{3})->size(), ChunkOffset{100});
+}
+
+TEST_F(LoadTableTest, RejectMalformedRows) {
+  auto file = std::ofstream{file_name, std::ios::app};
+  file << "1|missing values\n";
+  file.close();
+  EXPECT_THROW(load_table(file_name, 7), std::logic_error);
+
+  std::ofstream{file_name} << "a\nint\n12abc\n";
+  EXPECT_THROW(load_table(file_name, 7), std::logic_error);
+  EXPECT_THROW(load_table(file_name, 7, EncodingType::Dictionary, 2), std::logic_error);
+  EXPECT_THROW(load_table("src/test/tables/does_not_exist.tbl", 7), std::logic_error);
+}
+
+}  // namespace opossum
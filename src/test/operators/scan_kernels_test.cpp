@@ -0,0 +1,104 @@
+#include "base_test.hpp"
+
+#include "operators/scan_kernels.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/comparator.hpp"
+
+namespace opossum {
+
+class OperatorsScanKernelsTest : public BaseTest {
+ protected:
+  // Checks that the kernel selected for a segment finds the same rows as comparing the values one by one.
+  template <typename T>
+  void expect_kernel_matches(const AbstractSegment& segment, const T& search_value, const bool may_contain_nulls) {
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+      auto expected_matches = PosList{};
+      with_comparator(scan_type, [&](const auto comparator) {
+        segment_iterate<T>(segment, [&](const auto& position) {
+          if (!position.is_null() && comparator(position.value(), search_value)) {
+            expected_matches.emplace_back(RowID{ChunkID{3}, position.chunk_offset()});
+          }
+        });
+      });
+
+      auto matches = PosList{};
+      ScanKernels<T>::select(segment, scan_type, may_contain_nulls)(segment, search_value, ChunkID{3}, matches);
+      EXPECT_EQ(matches, expected_matches);
+    }
+  }
+
+  template <typename T>
+  std::shared_ptr<ValueSegment<T>> make_segment(const bool nullable) {
+    auto values = std::vector<T>{};
+    auto null_values = NullBitmap{};
+    for (auto index = 0; index < 300; ++index) {
+      if constexpr (std::is_same_v<T, std::string>) {
+        values.emplace_back("value " + std::to_string(index % 17 + 10));
+      } else {
+        values.emplace_back(static_cast<T>(index % 17));
+      }
+      null_values.push_back(nullable && index % 7 == 0);
+    }
+    if (!nullable) {
+      return std::make_shared<ValueSegment<T>>(std::move(values));
+    }
+    return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  }
+};
+
+TEST_F(OperatorsScanKernelsTest, IntegerKernels) {
+  for (const auto nullable : {false, true}) {
+    const auto value_segment = make_segment<int32_t>(nullable);
+    const auto& values = value_segment->values();
+    const auto null_values = nullable ? std::optional<NullBitmap>{value_segment->null_values()} : std::nullopt;
+    const auto segments = std::vector<std::shared_ptr<AbstractSegment>>{
+        value_segment, std::make_shared<DictionarySegment<int32_t>>(value_segment),
+        std::make_shared<DictionarySegment<int32_t>>(value_segment, VectorCompressionType::BitPacked),
+        std::make_shared<RunLengthSegment<int32_t>>(value_segment),
+        std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment),
+        std::make_shared<ExternalSegment<int32_t>>(std::span<const int32_t>{values}, value_segment,
+                                                   std::optional<NullBitmap>{null_values})};
+    for (const auto& segment : segments) {
+      for (const auto search_value : {-1, 0, 8, 16, 20}) {
+        expect_kernel_matches<int32_t>(*segment, search_value, nullable);
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsScanKernelsTest, StringKernels) {
+  for (const auto nullable : {false, true}) {
+    const auto value_segment = make_segment<std::string>(nullable);
+    const auto segments = std::vector<std::shared_ptr<AbstractSegment>>{
+        value_segment, std::make_shared<DictionarySegment<std::string>>(value_segment),
+        std::make_shared<DictionarySegment<std::string>>(value_segment, VectorCompressionType::BitPacked, true),
+        std::make_shared<RunLengthSegment<std::string>>(value_segment)};
+    for (const auto& segment : segments) {
+      for (const auto& search_value : {std::string{"value 1"}, std::string{"value 18"}, std::string{"value 9"}}) {
+        expect_kernel_matches<std::string>(*segment, search_value, nullable);
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsScanKernelsTest, NullableSegmentWithoutNulls) {
+  // Statistics can tell that a nullable segment holds no NULL values, so that the kernel does not need to check them.
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{1, 2, 3}, NullBitmap{3});
+  expect_kernel_matches<int32_t>(*value_segment, 2, false);
+  expect_kernel_matches<int32_t>(DictionarySegment<int32_t>{value_segment}, 2, false);
+}
+
+TEST_F(OperatorsScanKernelsTest, UnsupportedSegments) {
+  EXPECT_THROW(ScanKernels<std::string>::get(ScanType::OpEquals, ScanEncoding::FrameOfReference, false),
+               std::logic_error);
+  EXPECT_THROW(ScanKernels<float>::get(ScanType::OpEquals, ScanEncoding::FrameOfReference, true), std::logic_error);
+  EXPECT_NE(ScanKernels<float>::get(ScanType::OpEquals, ScanEncoding::External, true), nullptr);
+
+  const auto table = std::make_shared<Table>();
+  table->add_column("a", "int", false);
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, std::make_shared<PosList>()};
+  EXPECT_THROW(ScanKernels<int32_t>::select(reference_segment, ScanType::OpEquals, false), std::logic_error);
+}
+
+}  // namespace opossum
@@ -3,6 +3,7 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/load_table.hpp"
 
@@ -283,4 +284,111 @@ TEST_F(OperatorsTableScanTest, ScanOnReferenceSegmentWithNullValue) {
   }
 }
 
+TEST_F(OperatorsTableScanTest, ParallelScanKeepsChunkOrder) {
+  auto table = std::make_shared<Table>(7);
+  table->add_column("a", "int", true);
+  auto expected_values = std::vector<AllTypeVariant>{};
+  for (auto index = 0; index < 500; ++index) {
+    const auto is_null = index % 11 == 0;
+    table->append({is_null ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index % 13}});
+    if (!is_null && index % 13 > 1 && index % 13 < 4) {
+      expected_values.emplace_back(index % 13);
+    }
+  }
+  // Mix encoded and unencoded chunks.
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 3) {
+    table->compress_chunk(chunk_id);
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto serial_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 4, 1);
+  EXPECT_EQ(serial_scan->max_parallelism(), 1);
+  serial_scan->execute();
+  const auto expected_table = serial_scan->get_output();
+
+  for (const auto max_parallelism : {size_t{0}, size_t{3}, size_t{64}}) {
+    auto parallel_scan =
+        std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 4, max_parallelism);
+    parallel_scan->execute();
+    EXPECT_TABLE_EQ(parallel_scan->get_output(), expected_table, true);
+    EXPECT_EQ(parallel_scan->get_output()->chunk_count(), expected_table->chunk_count());
+
+    // Scanning the reference segments of the output works the same way.
+    auto second_scan =
+        std::make_shared<TableScan>(parallel_scan, ColumnID{0}, ScanType::OpGreaterThan, 1, max_parallelism);
+    second_scan->execute();
+    ASSERT_COLUMN_EQ(second_scan->get_output(), ColumnID{0}, expected_values);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, DictionaryScanMatchesValueScan) {
+  // The dictionary scan compares value ids of every width, with and without NULL values. Only even values are stored,
+  // so that odd search values are not part of the dictionary. The row counts are no multiples of the block sizes.
+  for (const auto distinct_count : {5, 300, 65'600}) {
+    for (const auto nullable : {false, true}) {
+      const auto row_count = distinct_count * 2 + 37;
+      auto values = std::vector<int32_t>(row_count);
+      auto nulls = NullBitmap(static_cast<size_t>(row_count));
+      for (auto index = 0; index < row_count; ++index) {
+        values[index] = (index * 7 % distinct_count) * 2;
+        nulls.set(index, nullable && index % 5 == 0);
+      }
+      auto null_values = nullable ? std::optional<NullBitmap>{nulls} : std::nullopt;
+      const auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(null_values));
+
+      const auto make_table_wrapper = [&](const std::shared_ptr<AbstractSegment>& segment) {
+        auto table = std::make_shared<Table>(static_cast<ChunkOffset>(row_count));
+        table->add_column("a", "int", nullable);
+        table->append_chunk({segment});
+        const auto table_wrapper = std::make_shared<TableWrapper>(table);
+        table_wrapper->execute();
+        return table_wrapper;
+      };
+      const auto value_table_wrapper = make_table_wrapper(value_segment);
+      // Both inputs have a single chunk, so the scans' outputs have a single chunk, too.
+      const auto positions = [](const std::shared_ptr<const AbstractOperator>& scan) {
+        const auto output_segment = scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+        return *std::dynamic_pointer_cast<const ReferenceSegment>(output_segment)->pos_list();
+      };
+
+      for (const auto compression_type : {VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacked}) {
+        const auto dictionary_table_wrapper =
+            make_table_wrapper(std::make_shared<DictionarySegment<int32_t>>(value_segment, compression_type));
+        for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                     ScanType::OpLessThanEquals, ScanType::OpGreaterThan,
+                                     ScanType::OpGreaterThanEquals}) {
+          for (const auto search_value :
+               {-1, 0, 7, 8, distinct_count - 1, distinct_count * 2 - 2, distinct_count * 2}) {
+            auto expected_scan = std::make_shared<TableScan>(value_table_wrapper, ColumnID{0}, scan_type, search_value);
+            expected_scan->execute();
+            auto scan = std::make_shared<TableScan>(dictionary_table_wrapper, ColumnID{0}, scan_type, search_value);
+            scan->execute();
+            EXPECT_EQ(positions(scan), positions(expected_scan));
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, DictionaryScanMatchingAllRows) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int", false);
+  for (auto index = 0; index < 100; ++index) {
+    table->append({index % 10});
+  }
+  // The statistics of the compressed chunk show that there are no NULL values.
+  table->compress_chunk(ChunkID{0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto& [scan_type, search_value] : std::vector<std::pair<ScanType, int32_t>>{
+           {ScanType::OpGreaterThanEquals, 0}, {ScanType::OpLessThan, 10}, {ScanType::OpNotEquals, 42}}) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), 100);
+  }
+}
+
 }  // namespace opossum
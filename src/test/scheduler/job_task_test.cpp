@@ -0,0 +1,70 @@
+#include <atomic>
+#include <mutex>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class JobTaskTest : public BaseTest {};
+
+TEST_F(JobTaskTest, RespectsDependencies) {
+  // a -> b, a -> c, (b, c) -> d
+  auto order = std::vector<char>{};
+  auto order_mutex = std::mutex{};
+  const auto make_task = [&](const char name) {
+    return std::make_shared<JobTask>([&, name]() {
+      const auto lock = std::lock_guard{order_mutex};
+      order.emplace_back(name);
+    });
+  };
+  const auto a = make_task('a');
+  const auto b = make_task('b');
+  const auto c = make_task('c');
+  const auto d = make_task('d');
+  a->set_as_predecessor_of(b);
+  a->set_as_predecessor_of(c);
+  b->set_as_predecessor_of(d);
+  c->set_as_predecessor_of(d);
+  EXPECT_EQ(a->successors().size(), 2);
+
+  // The order of scheduling does not matter.
+  schedule_and_wait_for_tasks({d, c, b, a});
+  EXPECT_TRUE(d->is_done());
+  ASSERT_EQ(order.size(), 4);
+  EXPECT_EQ(order.front(), 'a');
+  EXPECT_EQ(order.back(), 'd');
+
+  EXPECT_THROW(a->schedule(), std::logic_error);
+  EXPECT_THROW(a->set_as_predecessor_of(make_task('e')), std::logic_error);
+}
+
+TEST_F(JobTaskTest, PassesOnExceptions) {
+  auto successor_ran = std::atomic<bool>{false};
+  const auto failing_task = std::make_shared<JobTask>([]() { Fail("Task failed."); });
+  const auto successor = std::make_shared<JobTask>([&]() { successor_ran = true; });
+  failing_task->set_as_predecessor_of(successor);
+  successor->schedule();
+  failing_task->schedule();
+
+  EXPECT_THROW(successor->wait(), std::logic_error);
+  EXPECT_THROW(failing_task->wait(), std::logic_error);
+  EXPECT_FALSE(successor_ran);
+}
+
+TEST_F(JobTaskTest, TasksCanWaitForSubTasks) {
+  auto sum = std::atomic<int32_t>{0};
+  const auto task = std::make_shared<JobTask>([&]() {
+    auto sub_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto index = 0; index < 100; ++index) {
+      sub_tasks.emplace_back(std::make_shared<JobTask>([&sum, index]() { sum += index; }));
+    }
+    schedule_and_wait_for_tasks(sub_tasks);
+  });
+  schedule_and_wait_for_tasks({task});
+  EXPECT_EQ(sum, 4950);
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#include "base_test.hpp"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/operator_task.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorTaskTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorTaskTest, ExecutesPlan) {
+  const auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  const auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::OpLessThan, 1000);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(scan_b);
+  ASSERT_EQ(tasks.size(), 3);
+  EXPECT_EQ(std::dynamic_pointer_cast<OperatorTask>(tasks[0])->get_operator(), _table_wrapper);
+  EXPECT_EQ(std::dynamic_pointer_cast<OperatorTask>(tasks[2])->get_operator(), scan_b);
+  EXPECT_EQ(tasks[0]->successors(), std::vector<std::shared_ptr<AbstractTask>>{tasks[1]});
+
+  schedule_and_wait_for_tasks(tasks);
+  const auto expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
+  EXPECT_TABLE_EQ(scan_b->get_output(), expected_result);
+}
+
+TEST_F(OperatorTaskTest, SharedInputsAreExecutedOnce) {
+  const auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 123);
+  const auto scan_b = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 1234);
+  const auto tasks_a = OperatorTask::make_tasks_from_operator(scan_a);
+  EXPECT_EQ(tasks_a.size(), 2);
+
+  // Plans of a single operator have a single task.
+  const auto wrapper_tasks = OperatorTask::make_tasks_from_operator(_table_wrapper);
+  ASSERT_EQ(wrapper_tasks.size(), 1);
+  schedule_and_wait_for_tasks(wrapper_tasks);
+
+  // Both scans read the already executed wrapper concurrently.
+  const auto task_a = std::make_shared<OperatorTask>(scan_a);
+  const auto task_b = std::make_shared<OperatorTask>(scan_b);
+  schedule_and_wait_for_tasks({task_a, task_b});
+  EXPECT_EQ(scan_a->get_output()->row_count(), 1);
+  EXPECT_EQ(scan_b->get_output()->row_count(), 1);
+}
+
+}  // namespace opossum
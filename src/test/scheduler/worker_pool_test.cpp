@@ -0,0 +1,65 @@
+#include <atomic>
+
+#include "base_test.hpp"
+
+#include "scheduler/worker_pool.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class WorkerPoolTest : public BaseTest {};
+
+TEST_F(WorkerPoolTest, RunsAllJobs) {
+  auto worker_pool = WorkerPool{3};
+  EXPECT_EQ(worker_pool.worker_count(), 3);
+  auto counter = std::atomic<size_t>{0};
+  auto results = std::vector<std::future<size_t>>{};
+  for (auto index = size_t{0}; index < 100; ++index) {
+    results.emplace_back(worker_pool.submit([&counter, index]() {
+      ++counter;
+      return index * 2;
+    }));
+  }
+  for (auto index = size_t{0}; index < 100; ++index) {
+    EXPECT_EQ(results[index].get(), index * 2);
+  }
+  EXPECT_EQ(counter, 100);
+}
+
+TEST_F(WorkerPoolTest, PassesOnExceptions) {
+  auto worker_pool = WorkerPool{1};
+  auto result = worker_pool.submit([]() { Fail("Job failed."); });
+  EXPECT_THROW(result.get(), std::logic_error);
+}
+
+TEST_F(WorkerPoolTest, JobsCanWaitForTheirJobs) {
+  // With a single worker, a job that blocks while waiting for its sub-jobs would never finish.
+  auto worker_pool = WorkerPool{1};
+  auto result = worker_pool.submit([&worker_pool]() {
+    auto sub_results = std::vector<std::future<int32_t>>{};
+    for (auto index = 0; index < 10; ++index) {
+      sub_results.emplace_back(worker_pool.submit([index]() { return index; }));
+    }
+    auto sum = 0;
+    for (auto& sub_result : sub_results) {
+      worker_pool.wait(sub_result);
+      sum += sub_result.get();
+    }
+    return sum;
+  });
+  worker_pool.wait(result);
+  EXPECT_EQ(result.get(), 45);
+}
+
+TEST_F(WorkerPoolTest, RunsRemainingJobsOnDestruction) {
+  auto counter = std::atomic<size_t>{0};
+  {
+    auto worker_pool = WorkerPool{2};
+    for (auto index = 0; index < 50; ++index) {
+      worker_pool.schedule([&counter]() { ++counter; });
+    }
+  }
+  EXPECT_EQ(counter, 50);
+}
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#include "base_test.hpp"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/blocked_bloom_filter.hpp"
+#include "statistics/segment_statistics.hpp"
+
+namespace opossum {
+
+class StatisticsBlockedBloomFilterTest : public BaseTest {};
+
+TEST_F(StatisticsBlockedBloomFilterTest, NoFalseNegatives) {
+  auto bloom_filter = BlockedBloomFilter{1000};
+  EXPECT_EQ(bloom_filter.block_count(), 40);
+  EXPECT_EQ(bloom_filter.estimate_memory_usage(), 40 * 32);
+  for (auto value = size_t{0}; value < 1000; ++value) {
+    bloom_filter.insert(value * 7);
+  }
+  for (auto value = size_t{0}; value < 1000; ++value) {
+    EXPECT_TRUE(bloom_filter.may_contain(value * 7));
+  }
+
+  // Ten bits per value result in a false positive rate of about 1%.
+  auto false_positives = 0;
+  for (auto value = size_t{0}; value < 10000; ++value) {
+    false_positives += bloom_filter.may_contain(value * 7 + 1);
+  }
+  EXPECT_LT(false_positives, 300);
+
+  const auto empty_filter = BlockedBloomFilter{0};
+  EXPECT_EQ(empty_filter.block_count(), 1);
+  EXPECT_FALSE(empty_filter.may_contain(42));
+}
+
+TEST_F(StatisticsBlockedBloomFilterTest, PruneEqualsInSegmentStatistics) {
+  auto value_segment = ValueSegment<std::string>{};
+  for (auto value = 0; value < 1000; value += 2) {
+    value_segment.append(std::to_string(value));
+  }
+  const auto statistics = SegmentStatistics<std::string>{value_segment, true};
+  ASSERT_TRUE(statistics.bloom_filter());
+  EXPECT_EQ(SegmentStatistics<std::string>{value_segment}.bloom_filter(), nullptr);
+
+  auto pruned_count = 0;
+  for (auto value = 0; value < 1000; ++value) {
+    const auto can_prune = statistics.can_prune(ScanType::OpEquals, std::to_string(value));
+    if (value % 2 == 0) {
+      EXPECT_FALSE(can_prune);
+    }
+    pruned_count += can_prune;
+  }
+  EXPECT_GT(pruned_count, 480);
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpNotEquals, "1"));
+}
+
+TEST_F(StatisticsBlockedBloomFilterTest, CreateStatisticsForSealedChunks) {
+  const auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int", false);
+  for (auto value = int32_t{0}; value < 250; ++value) {
+    table->append({value * 2});
+  }
+  EXPECT_THROW(table->create_segment_statistics(ChunkID{2}), std::logic_error);
+  table->create_segment_statistics(ChunkID{0});
+  table->create_segment_statistics(ChunkID{1});
+  const auto statistics = std::dynamic_pointer_cast<const SegmentStatistics<int32_t>>(
+      table->get_chunk(ChunkID{1})->get_segment_statistics(ColumnID{0}));
+  ASSERT_TRUE(statistics);
+  EXPECT_TRUE(statistics->bloom_filter());
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(table->get_chunk(ChunkID{1})->get_segment(ColumnID{0})));
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 250);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 1);
+}
+
+}  // namespace opossum
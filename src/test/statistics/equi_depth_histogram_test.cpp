@@ -0,0 +1,70 @@
+#include "base_test.hpp"
+
+#include "statistics/equi_depth_histogram.hpp"
+
+namespace opossum {
+
+class StatisticsEquiDepthHistogramTest : public BaseTest {
+ protected:
+  // Values 1 to 100, each occurring once, and 50 occurring 101 times in total.
+  std::vector<std::pair<int32_t, ChunkOffset>> value_counts() const {
+    auto value_counts = std::vector<std::pair<int32_t, ChunkOffset>>{};
+    for (auto value = int32_t{1}; value <= 100; ++value) {
+      value_counts.emplace_back(value, value == 50 ? 101 : 1);
+    }
+    return value_counts;
+  }
+};
+
+TEST_F(StatisticsEquiDepthHistogramTest, Bins) {
+  const auto histogram = EquiDepthHistogram<int32_t>{value_counts(), 4};
+  EXPECT_EQ(histogram.total_count(), 200);
+  const auto& bins = histogram.bins();
+  ASSERT_EQ(bins.size(), 3);
+  EXPECT_EQ(bins[0].minimum, 1);
+  EXPECT_EQ(bins[0].maximum, 49);
+  EXPECT_EQ(bins[0].height, 49);
+  EXPECT_EQ(bins[0].distinct_count, 49);
+  // The frequent value gets a bin of its own.
+  EXPECT_EQ(bins[1].minimum, 50);
+  EXPECT_EQ(bins[1].maximum, 50);
+  EXPECT_EQ(bins[1].height, 101);
+  EXPECT_EQ(bins[2].minimum, 51);
+  EXPECT_EQ(bins[2].maximum, 100);
+  EXPECT_EQ(bins[2].distinct_count, 50);
+
+  const auto empty_histogram = EquiDepthHistogram<std::string>{{}};
+  EXPECT_EQ(empty_histogram.bins().size(), 0);
+  EXPECT_EQ(empty_histogram.estimate_cardinality(ScanType::OpLessThan, std::string{"a"}), 0.0f);
+}
+
+TEST_F(StatisticsEquiDepthHistogramTest, EstimateCardinality) {
+  const auto histogram = EquiDepthHistogram<int32_t>{value_counts(), 20};
+  EXPECT_FLOAT_EQ(histogram.estimate_cardinality(ScanType::OpEquals, 50), 101.0f);
+  EXPECT_FLOAT_EQ(histogram.estimate_cardinality(ScanType::OpEquals, 200), 0.0f);
+  EXPECT_NEAR(histogram.estimate_cardinality(ScanType::OpEquals, 7), 1.0f, 0.01f);
+  EXPECT_NEAR(histogram.estimate_cardinality(ScanType::OpLessThan, 11), 10.0f, 0.01f);
+  EXPECT_NEAR(histogram.estimate_cardinality(ScanType::OpLessThanEquals, 50), 150.0f, 0.01f);
+  EXPECT_NEAR(histogram.estimate_cardinality(ScanType::OpGreaterThan, 50), 50.0f, 0.01f);
+  EXPECT_NEAR(histogram.estimate_cardinality(ScanType::OpGreaterThanEquals, 95), 6.0f, 0.01f);
+  EXPECT_NEAR(histogram.estimate_cardinality(ScanType::OpNotEquals, 50), 99.0f, 0.01f);
+  EXPECT_FLOAT_EQ(histogram.estimate_cardinality(ScanType::OpEquals, NULL_VALUE), 0.0f);
+  EXPECT_NEAR(histogram.estimate_cardinality(ScanType::OpLessThan, AllTypeVariant{int64_t{11}}), 10.0f, 0.01f);
+}
+
+TEST_F(StatisticsEquiDepthHistogramTest, Merge) {
+  auto first_counts = std::vector<std::pair<std::string, ChunkOffset>>{{"a", 10}, {"b", 10}, {"c", 10}};
+  auto second_counts = std::vector<std::pair<std::string, ChunkOffset>>{{"c", 10}, {"x", 20}, {"y", 10}, {"z", 10}};
+  const auto first = std::make_shared<EquiDepthHistogram<std::string>>(first_counts, 3);
+  const auto second = std::make_shared<EquiDepthHistogram<std::string>>(second_counts, 4);
+
+  const auto merged = EquiDepthHistogram<std::string>::merge({first, second}, 4);
+  EXPECT_EQ(merged->total_count(), 80);
+  EXPECT_LE(merged->bins().size(), 4);
+  EXPECT_EQ(merged->bins().front().minimum, "a");
+  EXPECT_EQ(merged->bins().back().maximum, "z");
+  EXPECT_NEAR(merged->estimate_cardinality(ScanType::OpLessThan, std::string{"m"}), 40.0f, 10.0f);
+  EXPECT_NEAR(merged->estimate_cardinality(ScanType::OpEquals, std::string{"x"}), 20.0f, 10.0f);
+}
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include "base_test.hpp"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/segment_statistics.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+
+namespace opossum {
+
+class StatisticsSegmentStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    value_segment = std::make_shared<ValueSegment<int32_t>>(true);
+    for (const auto value : {7, 3, 3, 9, 5}) {
+      value_segment->append(value);
+    }
+    value_segment->append(NULL_VALUE);
+    value_segment->append(NULL_VALUE);
+  }
+
+  void EXPECT_STATISTICS(const SegmentStatistics<int32_t>& statistics) {
+    EXPECT_EQ(statistics.min(), 3);
+    EXPECT_EQ(statistics.max(), 9);
+    EXPECT_EQ(statistics.null_count(), 2);
+    EXPECT_EQ(statistics.distinct_count(), 4);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> value_segment;
+};
+
+TEST_F(StatisticsSegmentStatisticsTest, AllSegmentTypes) {
+  EXPECT_STATISTICS(SegmentStatistics<int32_t>{*value_segment});
+  EXPECT_STATISTICS(SegmentStatistics<int32_t>{DictionarySegment<int32_t>{value_segment}});
+  EXPECT_STATISTICS(
+      SegmentStatistics<int32_t>{DictionarySegment<int32_t>{value_segment, VectorCompressionType::BitPacked}});
+  EXPECT_STATISTICS(SegmentStatistics<int32_t>{RunLengthSegment<int32_t>{value_segment}});
+  EXPECT_STATISTICS(SegmentStatistics<int32_t>{FrameOfReferenceSegment<int32_t>{value_segment}});
+
+  const auto empty_segment = ValueSegment<std::string>{};
+  const auto empty_statistics = SegmentStatistics<std::string>{empty_segment};
+  EXPECT_EQ(empty_statistics.min(), std::nullopt);
+  EXPECT_EQ(empty_statistics.distinct_count(), 0);
+}
+
+TEST_F(StatisticsSegmentStatisticsTest, CanPrune) {
+  const auto statistics = SegmentStatistics<int32_t>{*value_segment};
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 2));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 4));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 10));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpNotEquals, 3));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThan, 3));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThanEquals, 3));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThan, 9));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThanEquals, 9));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, NULL_VALUE));
+
+  auto constant_segment = std::make_shared<ValueSegment<int32_t>>();
+  constant_segment->append(4);
+  constant_segment->append(4);
+  EXPECT_TRUE(SegmentStatistics<int32_t>{*constant_segment}.can_prune(ScanType::OpNotEquals, 4));
+
+  auto null_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  null_segment->append(NULL_VALUE);
+  EXPECT_TRUE(SegmentStatistics<int32_t>{*null_segment}.can_prune(ScanType::OpNotEquals, 4));
+}
+
+TEST_F(StatisticsSegmentStatisticsTest, CompressChunkAndPruneScan) {
+  const auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int", false);
+  table->add_column("b", "string", true);
+  for (auto value = int32_t{0}; value < 9; ++value) {
+    table->append({value, std::to_string(value)});
+  }
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->get_segment_statistics(ColumnID{0}), nullptr);
+
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  const auto statistics = std::dynamic_pointer_cast<const SegmentStatistics<std::string>>(
+      table->get_chunk(ChunkID{1})->get_segment_statistics(ColumnID{1}));
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->min(), "3");
+  EXPECT_EQ(statistics->max(), "5");
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 3);
+  scan->execute();
+  // The first chunk is pruned, so it does not appear in the output.
+  EXPECT_EQ(scan->get_output()->row_count(), 5);
+  EXPECT_EQ(scan->get_output()->chunk_count(), 2);
+}
+
+}  // namespace opossum
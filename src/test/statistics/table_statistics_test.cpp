@@ -0,0 +1,61 @@
+#include "base_test.hpp"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/equi_depth_histogram.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace opossum {
+
+class StatisticsTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(100);
+    table->add_column("a", "int", false);
+    table->add_column("b", "double", true);
+    for (auto value = int32_t{0}; value < 1000; ++value) {
+      table->append({value, value % 10 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value / 100.0}});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{5}; ++chunk_id) {
+      table->compress_chunk(chunk_id);
+    }
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(StatisticsTableStatisticsTest, EstimateSelectivity) {
+  const auto statistics = TableStatistics{*table};
+  EXPECT_EQ(statistics.row_count(), 1000);
+  EXPECT_EQ(statistics.histogram(ColumnID{0})->total_count(), 1000);
+  EXPECT_EQ(statistics.histogram(ColumnID{1})->total_count(), 900);
+  EXPECT_THROW(statistics.histogram(ColumnID{2}), std::logic_error);
+
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 250), 0.25f, 0.03f);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 900), 0.1f, 0.03f);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 42), 0.001f, 0.001f);
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 5000), 0.0f);
+  // NULL values never match, so only 90% of the rows can satisfy any predicate on column b.
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{1}, ScanType::OpGreaterThan, -1.0), 0.9f, 0.01f);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{1}, ScanType::OpLessThan, 5.0), 0.45f, 0.03f);
+
+  const auto empty_table = Table{};
+  EXPECT_EQ(TableStatistics{empty_table}.row_count(), 0);
+}
+
+TEST_F(StatisticsTableStatisticsTest, ScanOutput) {
+  // The output of a TableScan consists of ReferenceSegments, which have no statistics of their own.
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 550);
+  table_scan->execute();
+
+  const auto statistics = TableStatistics{*table_scan->get_output()};
+  EXPECT_EQ(statistics.row_count(), 550);
+  EXPECT_EQ(statistics.histogram(ColumnID{0})->total_count(), 550);
+  EXPECT_EQ(statistics.histogram(ColumnID{1})->total_count(), 495);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 275), 0.5f, 0.03f);
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThan, 600), 0.0f);
+}
+
+}  // namespace opossum
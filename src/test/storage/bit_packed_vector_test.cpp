@@ -0,0 +1,105 @@
+#include "base_test.hpp"
+
+#include "storage/bit_packed_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+
+namespace opossum {
+
+class StorageBitPackedVectorTest : public BaseTest {
+ protected:
+  static std::vector<ValueID> _value_ids(const uint32_t count, const uint32_t modulo) {
+    auto value_ids = std::vector<ValueID>{};
+    value_ids.reserve(count);
+    for (auto value = uint32_t{0}; value < count; ++value) {
+      value_ids.emplace_back((value * 7) % modulo);
+    }
+    return value_ids;
+  }
+};
+
+TEST_F(StorageBitPackedVectorTest, RequiredBitWidth) {
+  EXPECT_EQ(BitPackedVector::required_bit_width(0), 1);
+  EXPECT_EQ(BitPackedVector::required_bit_width(1), 1);
+  EXPECT_EQ(BitPackedVector::required_bit_width(2), 2);
+  EXPECT_EQ(BitPackedVector::required_bit_width(300), 9);
+  EXPECT_EQ(BitPackedVector::required_bit_width(std::numeric_limits<uint32_t>::max()), 32);
+}
+
+TEST_F(StorageBitPackedVectorTest, GetAndSetForAllBitWidths) {
+  for (auto bit_width = uint8_t{1}; bit_width <= 32; ++bit_width) {
+    // Keep the largest representable value free, as it is used for NULL values.
+    const auto modulo = static_cast<uint32_t>(std::min(uint64_t{1} << bit_width, uint64_t{1} << 31) - 1);
+    const auto value_ids = _value_ids(200, modulo);
+    auto vector = BitPackedVector{value_ids, bit_width};
+
+    EXPECT_EQ(vector.size(), 200);
+    EXPECT_EQ(vector.bit_width(), bit_width);
+    EXPECT_EQ(vector.width(), (bit_width + 7) / 8);
+    for (auto index = size_t{0}; index < value_ids.size(); ++index) {
+      EXPECT_EQ(vector.get(index), value_ids[index]);
+    }
+
+    vector.set(63, ValueID{0});
+    vector.set(64, NULL_VALUE_ID);
+    EXPECT_EQ(vector.get(62), value_ids[62]);
+    EXPECT_EQ(vector.get(63), ValueID{0});
+    EXPECT_EQ(vector.get(64), ValueID{static_cast<uint32_t>((uint64_t{1} << bit_width) - 1)});
+    EXPECT_EQ(vector.get(65), value_ids[65]);
+  }
+}
+
+TEST_F(StorageBitPackedVectorTest, DecodeRange) {
+  for (const auto bit_width : {uint8_t{3}, uint8_t{9}, uint8_t{17}, uint8_t{25}, uint8_t{26}, uint8_t{32}}) {
+    const auto value_ids = _value_ids(1000, 7919);
+    const auto vector = BitPackedVector{value_ids, std::max(bit_width, BitPackedVector::required_bit_width(7919))};
+
+    auto decoded = std::vector<ValueID>{};
+    vector.decode_range(0, 1000, decoded);
+    EXPECT_EQ(decoded, value_ids);
+
+    // Ranges that do not start at a block boundary and do not cover full blocks.
+    vector.decode_range(13, 42, decoded);
+    ASSERT_EQ(decoded.size(), 29);
+    for (auto index = size_t{0}; index < decoded.size(); ++index) {
+      EXPECT_EQ(decoded[index], value_ids[13 + index]);
+    }
+
+    vector.decode_range(5, 5, decoded);
+    EXPECT_TRUE(decoded.empty());
+  }
+}
+
+TEST_F(StorageBitPackedVectorTest, InvalidAccess) {
+  auto vector = BitPackedVector{_value_ids(10, 7), 3};
+  EXPECT_THROW(vector.get(10), std::logic_error);
+  EXPECT_THROW(vector.set(0, ValueID{8}), std::logic_error);
+  auto decoded = std::vector<ValueID>{};
+  EXPECT_THROW(vector.decode_range(5, 11, decoded), std::logic_error);
+  EXPECT_THROW((BitPackedVector{{}, 0}), std::logic_error);
+  EXPECT_THROW((BitPackedVector{{}, 33}), std::logic_error);
+}
+
+TEST_F(StorageBitPackedVectorTest, MemoryUsage) {
+  // 300 distinct values need 9 bits per value id. Together with the padding word, 1000 values fit into 142 words.
+  const auto vector = BitPackedVector{_value_ids(1000, 300), 9};
+  EXPECT_EQ(vector.estimate_memory_usage(), 142 * sizeof(uint64_t));
+}
+
+TEST_F(StorageBitPackedVectorTest, UsedByDictionarySegment) {
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  for (auto value = int32_t{0}; value < 300; ++value) {
+    value_segment->append(value);
+  }
+  value_segment->append(NULL_VALUE);
+
+  const auto dict_segment = DictionarySegment<int32_t>{value_segment, VectorCompressionType::BitPacked};
+  const auto bit_packed_vector = std::dynamic_pointer_cast<const BitPackedVector>(dict_segment.attribute_vector());
+  ASSERT_TRUE(bit_packed_vector);
+  EXPECT_EQ(bit_packed_vector->bit_width(), 9);
+  EXPECT_EQ(dict_segment.null_value_id(), ValueID{511});
+  EXPECT_EQ(dict_segment.get(299), 299);
+  EXPECT_EQ(dict_segment.get_typed_value(300), std::nullopt);
+  EXPECT_EQ(dict_segment.estimate_memory_usage(), 44 * sizeof(uint64_t) + 300 * sizeof(int32_t));
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#include "base_test.hpp"
+
+#include "storage/buffer.hpp"
+
+namespace opossum {
+
+class StorageBufferTest : public BaseTest {};
+
+TEST_F(StorageBufferTest, OwnedValues) {
+  auto buffer = Buffer<int32_t>{std::vector<int32_t>{4, 2, 7}};
+  EXPECT_FALSE(buffer.is_external());
+  EXPECT_EQ(buffer.size(), 3);
+  EXPECT_EQ(buffer.front(), 4);
+  EXPECT_EQ(buffer.back(), 7);
+  EXPECT_EQ(buffer.estimate_memory_usage(), 3 * sizeof(int32_t));
+
+  buffer.mutable_data()[1] = 3;
+  EXPECT_EQ(buffer[1], 3);
+
+  // Copies and moves refer to their own values.
+  const auto copy = buffer;
+  EXPECT_NE(copy.data(), buffer.data());
+  EXPECT_EQ(copy, buffer);
+  const auto* data = buffer.data();
+  const auto moved = std::move(buffer);
+  EXPECT_EQ(moved.data(), data);
+  EXPECT_EQ(moved, copy);
+}
+
+TEST_F(StorageBufferTest, ExternalValues) {
+  const auto values = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+  auto buffer = Buffer<int32_t>{std::span<const int32_t>{*values}, values};
+  EXPECT_TRUE(buffer.is_external());
+  EXPECT_EQ(buffer.data(), values->data());
+  EXPECT_EQ(buffer.owner(), values);
+  EXPECT_THROW(buffer.mutable_data(), std::logic_error);
+
+  const auto copy = buffer;
+  EXPECT_EQ(copy.data(), values->data());
+  EXPECT_EQ(copy, (Buffer<int32_t>{std::vector<int32_t>{1, 2, 3}}));
+}
+
+}  // namespace opossum
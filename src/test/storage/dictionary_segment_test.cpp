@@ -88,6 +88,26 @@ TEST_F(StorageDictionarySegmentTest, DefaultValueIsNotConvertedToNullValue) {
   EXPECT_EQ(dict_segment->get(0), "");
 }
 
+TEST_F(StorageDictionarySegmentTest, NullValuesAcrossWords) {
+  // The NULL bitmap is read 64 rows at a time. Rows 64 to 127 are all NULL, rows 128 to 191 hold no NULL value, and
+  // the last word is only partially filled.
+  const auto int_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  for (auto index = int32_t{0}; index < 200; ++index) {
+    const auto is_null = (index >= 64 && index < 128) || (index < 64 && index % 7 == 0) || index >= 197;
+    int_segment->append(is_null ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index % 13});
+    value_segment_str->append(is_null ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{std::to_string(index % 13)});
+  }
+
+  const auto int_dictionary_segment = DictionarySegment<int32_t>{int_segment};
+  const auto string_dictionary_segment = DictionarySegment<std::string>{value_segment_str};
+  EXPECT_EQ(int_dictionary_segment.unique_values_count(), 13);
+  EXPECT_EQ(string_dictionary_segment.unique_values_count(), 13);
+  for (auto offset = ChunkOffset{0}; offset < 200; ++offset) {
+    EXPECT_EQ(int_dictionary_segment.get_typed_value(offset), int_segment->get_typed_value(offset));
+    EXPECT_EQ(string_dictionary_segment.get_typed_value(offset), value_segment_str->get_typed_value(offset));
+  }
+}
+
 TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
   for (auto value = int16_t{0}; value <= 10; value += 2) {
     value_segment_int->append(value);
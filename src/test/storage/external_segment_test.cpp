@@ -0,0 +1,90 @@
+#include "base_test.hpp"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/segment_statistics.hpp"
+#include "storage/external_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageExternalSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    buffer = std::make_shared<std::vector<int64_t>>(std::vector<int64_t>{5, 1, 8, 3});
+    auto null_values = NullBitmap{4};
+    null_values.set(2, true);
+    segment = std::make_shared<ExternalSegment<int64_t>>(*buffer, buffer, std::move(null_values));
+  }
+
+  std::shared_ptr<std::vector<int64_t>> buffer;
+  std::shared_ptr<ExternalSegment<int64_t>> segment;
+};
+
+TEST_F(StorageExternalSegmentTest, AccessValues) {
+  EXPECT_EQ(segment->size(), 4);
+  EXPECT_EQ(segment->values().data(), buffer->data());
+  EXPECT_EQ(segment->get(0), 5);
+  EXPECT_EQ(segment->get_typed_value(2), std::nullopt);
+  EXPECT_TRUE(variant_is_null((*segment)[2]));
+  EXPECT_EQ((*segment)[3], AllTypeVariant{int64_t{3}});
+  EXPECT_THROW(segment->get(2), std::logic_error);
+  EXPECT_THROW(ExternalSegment<int64_t>(*buffer, buffer, NullBitmap{3}), std::logic_error);
+}
+
+TEST_F(StorageExternalSegmentTest, KeepsOwnerAlive) {
+  const auto* data = buffer->data();
+  buffer.reset();
+  EXPECT_EQ(segment->owner().use_count(), 1);
+  EXPECT_EQ(segment->values().data(), data);
+  EXPECT_EQ(segment->get(3), 3);
+}
+
+TEST_F(StorageExternalSegmentTest, AppendChunkScanAndCompress) {
+  const auto table = std::make_shared<Table>(4);
+  table->add_column("a", "long", true);
+  table->add_column("b", "string", false);
+  table->append_chunk({segment, std::make_shared<ValueSegment<std::string>>(
+                                    std::vector<std::string>{"five", "one", "eight", "three"})});
+  EXPECT_EQ(table->row_count(), 4);
+  // The adopted chunk is followed by a new chunk for appends.
+  EXPECT_EQ(table->chunk_count(), 2);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), segment);
+  table->append({int64_t{7}, "seven"});
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 1);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 3);
+
+  table->create_segment_statistics(ChunkID{0});
+  const auto statistics = std::dynamic_pointer_cast<const SegmentStatistics<int64_t>>(
+      table->get_chunk(ChunkID{0})->get_segment_statistics(ColumnID{0}));
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->null_count(), 1);
+  EXPECT_EQ(statistics->max(), 5);
+
+  table->compress_chunk(ChunkID{0});
+  EXPECT_EQ((*table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[1], AllTypeVariant{int64_t{1}});
+  EXPECT_TRUE(variant_is_null((*table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[2]));
+}
+
+TEST_F(StorageExternalSegmentTest, AppendChunkValidatesSegments) {
+  auto table = Table{3};
+  table.add_column("a", "long", false);
+  const auto short_segment = std::make_shared<ExternalSegment<int64_t>>(std::span{buffer->data(), 2}, buffer);
+  const auto int_segment = std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{1, 2});
+  // Too many rows, NULLs in a not nullable column, and a wrong type.
+  EXPECT_THROW(table.append_chunk({std::make_shared<ExternalSegment<int64_t>>(*buffer, buffer)}), std::logic_error);
+  EXPECT_THROW(table.append_chunk({segment}), std::logic_error);
+  EXPECT_THROW(table.append_chunk({int_segment}), std::logic_error);
+  EXPECT_EQ(table.row_count(), 0);
+
+  table.append_chunk({short_segment});
+  EXPECT_EQ(table.row_count(), 2);
+}
+
+}  // namespace opossum
@@ -0,0 +1,134 @@
+#include "base_test.hpp"
+
+#include "storage/bit_packed_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Two blocks: the first one holds values around 1000, the second one values around -50.
+    for (auto index = int32_t{0}; index < static_cast<int32_t>(BLOCK_SIZE); ++index) {
+      value_segment_int->append(1000 + index % 10);
+    }
+    value_segment_int->append(NULL_VALUE);
+    value_segment_int->append(-50);
+    value_segment_int->append(-45);
+  }
+
+  static constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<int32_t>::BLOCK_SIZE;
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegment) {
+  const auto for_segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment_int);
+  EXPECT_THROW(std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment_int), std::logic_error);
+
+  EXPECT_EQ(for_segment->size(), BLOCK_SIZE + 3);
+  EXPECT_EQ(for_segment->block_minima(), (std::vector<int32_t>{1000, -50}));
+  EXPECT_EQ(for_segment->offsets()->bit_width(), 4);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment_int->size(); ++chunk_offset) {
+    EXPECT_EQ(for_segment->get_typed_value(chunk_offset), value_segment_int->get_typed_value(chunk_offset));
+  }
+  EXPECT_EQ((*for_segment)[BLOCK_SIZE + 2], AllTypeVariant{-45});
+  EXPECT_TRUE(variant_is_null((*for_segment)[BLOCK_SIZE]));
+  EXPECT_THROW(for_segment->get(BLOCK_SIZE), std::logic_error);
+  EXPECT_THROW(for_segment->get_typed_value(BLOCK_SIZE + 3), std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, ExtremeValues) {
+  const auto value_segment = std::make_shared<ValueSegment<int64_t>>();
+  value_segment->append(std::numeric_limits<int64_t>::min());
+  value_segment->append(std::numeric_limits<int64_t>::min() + 7);
+  auto for_segment = FrameOfReferenceSegment<int64_t>{value_segment};
+  EXPECT_EQ(for_segment.get(0), std::numeric_limits<int64_t>::min());
+  EXPECT_EQ(for_segment.get(1), std::numeric_limits<int64_t>::min() + 7);
+
+  // Offsets need to fit into 32 bits, so the block keeps its plain values.
+  value_segment->append(int64_t{0});
+  const auto unencoded_segment = FrameOfReferenceSegment<int64_t>{value_segment};
+  EXPECT_EQ(unencoded_segment.unencoded_blocks(), std::vector<uint32_t>{0});
+  EXPECT_EQ(unencoded_segment.get(0), std::numeric_limits<int64_t>::min());
+  EXPECT_EQ(unencoded_segment.get(2), 0);
+
+  const auto int_segment = std::make_shared<ValueSegment<int32_t>>();
+  int_segment->append(std::numeric_limits<int32_t>::min());
+  int_segment->append(std::numeric_limits<int32_t>::max());
+  const auto wide_segment = FrameOfReferenceSegment<int32_t>{int_segment};
+  EXPECT_EQ(wide_segment.offsets()->bit_width(), 32);
+  EXPECT_EQ(wide_segment.get(1), std::numeric_limits<int32_t>::max());
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, Scan) {
+  const auto for_segment = FrameOfReferenceSegment<int32_t>{value_segment_int};
+
+  // Compares the scan result with a row-by-row evaluation on the value segment.
+  const auto expect_scan_result = [&](const ScanType scan_type, const int32_t search_value, auto comparator) {
+    auto matches = PosList{};
+    for_segment.scan(scan_type, search_value, ChunkID{1}, matches);
+    auto expected_matches = PosList{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment_int->size(); ++chunk_offset) {
+      const auto value = value_segment_int->get_typed_value(chunk_offset);
+      if (value && comparator(*value, search_value)) {
+        expected_matches.emplace_back(RowID{ChunkID{1}, chunk_offset});
+      }
+    }
+    EXPECT_EQ(matches, expected_matches);
+  };
+
+  for (const auto search_value : {-100, -50, -47, -45, 0, 1000, 1005, 1009, 2000}) {
+    expect_scan_result(ScanType::OpEquals, search_value, std::equal_to<int32_t>{});
+    expect_scan_result(ScanType::OpNotEquals, search_value, std::not_equal_to<int32_t>{});
+    expect_scan_result(ScanType::OpLessThan, search_value, std::less<int32_t>{});
+    expect_scan_result(ScanType::OpLessThanEquals, search_value, std::less_equal<int32_t>{});
+    expect_scan_result(ScanType::OpGreaterThan, search_value, std::greater<int32_t>{});
+    expect_scan_result(ScanType::OpGreaterThanEquals, search_value, std::greater_equal<int32_t>{});
+  }
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, WideBlocks) {
+  // The second block spans more than 32 bits because of a single outlier, the other blocks are encoded as usual.
+  const auto value_segment = std::make_shared<ValueSegment<int64_t>>(true);
+  for (auto index = int64_t{0}; index < 3 * int64_t{BLOCK_SIZE}; ++index) {
+    if (index == BLOCK_SIZE + 3) {
+      value_segment->append(NULL_VALUE);
+    } else {
+      value_segment->append(index == BLOCK_SIZE + 7 ? int64_t{1} << 40 : index % 100);
+    }
+  }
+  const auto for_segment = FrameOfReferenceSegment<int64_t>{value_segment};
+  EXPECT_EQ(for_segment.unencoded_blocks(), std::vector<uint32_t>{1});
+  EXPECT_EQ(for_segment.unencoded_values().size(), BLOCK_SIZE);
+  EXPECT_EQ(for_segment.offsets()->bit_width(), 7);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment->size(); ++chunk_offset) {
+    EXPECT_EQ(for_segment.get_typed_value(chunk_offset), value_segment->get_typed_value(chunk_offset));
+  }
+
+  for (const auto search_value : {int64_t{0}, int64_t{50}, int64_t{1} << 40}) {
+    auto matches = PosList{};
+    for_segment.scan(ScanType::OpGreaterThanEquals, search_value, ChunkID{0}, matches);
+    auto expected_matches = PosList{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment->size(); ++chunk_offset) {
+      const auto value = value_segment->get_typed_value(chunk_offset);
+      if (value && *value >= search_value) {
+        expected_matches.emplace_back(RowID{ChunkID{0}, chunk_offset});
+      }
+    }
+    EXPECT_EQ(matches, expected_matches);
+  }
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MemoryUsage) {
+  const auto value_segment = std::make_shared<ValueSegment<int64_t>>();
+  for (auto value = int64_t{1'000'000'000'000}; value < 1'000'000'000'100; ++value) {
+    value_segment->append(value);
+  }
+  const auto for_segment = FrameOfReferenceSegment<int64_t>{value_segment};
+  // One minimum plus 100 offsets of 7 bits each, which fit into 11 words plus the padding word.
+  EXPECT_EQ(for_segment.estimate_memory_usage(), sizeof(int64_t) + 12 * sizeof(uint64_t));
+}
+
+}  // namespace opossum
@@ -0,0 +1,108 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/fsst_symbol_table.hpp"
+#include "storage/string_dictionary.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StorageFSSTSymbolTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto index = 0; index < 200; ++index) {
+      values.emplace_back("https://www.example.com/item/" + std::to_string(1000 + index));
+    }
+    views.assign(values.begin(), values.end());
+  }
+
+  std::vector<std::string> values;
+  std::vector<std::string_view> views;
+};
+
+TEST_F(StorageFSSTSymbolTableTest, RoundTrip) {
+  const auto symbol_table = FSSTSymbolTable{views};
+  EXPECT_GT(symbol_table.symbol_count(), 0);
+  EXPECT_LE(symbol_table.symbol_count(), FSSTSymbolTable::MAX_SYMBOL_COUNT);
+
+  auto total_encoded_size = size_t{0};
+  auto total_size = size_t{0};
+  for (const auto& value : values) {
+    auto encoded_value = std::string{};
+    symbol_table.encode(value, encoded_value);
+    auto decoded_value = std::string{};
+    symbol_table.decode(encoded_value, decoded_value);
+    EXPECT_EQ(decoded_value, value);
+    total_encoded_size += encoded_value.size();
+    total_size += value.size();
+  }
+  // The common prefix is covered by a few 8 byte symbols.
+  EXPECT_LT(total_encoded_size * 2, total_size);
+}
+
+TEST_F(StorageFSSTSymbolTableTest, EscapesUnknownBytes) {
+  const auto symbol_table = FSSTSymbolTable{views};
+  const auto value = std::string{"\xff\x01 unseen \xfe"};
+  auto encoded_value = std::string{};
+  symbol_table.encode(value, encoded_value);
+  EXPECT_EQ(static_cast<uint8_t>(encoded_value[0]), FSSTSymbolTable::ESCAPE_CODE);
+  auto decoded_value = std::string{};
+  symbol_table.decode(encoded_value, decoded_value);
+  EXPECT_EQ(decoded_value, value);
+
+  const auto empty_table = FSSTSymbolTable{std::vector<std::string_view>{}};
+  EXPECT_EQ(empty_table.symbol_count(), 0);
+  encoded_value.clear();
+  empty_table.encode("ab", encoded_value);
+  EXPECT_EQ(encoded_value.size(), 4);
+  EXPECT_THROW(empty_table.symbol(0), std::logic_error);
+}
+
+TEST_F(StorageFSSTSymbolTableTest, CompressedStringDictionary) {
+  const auto dictionary = StringDictionary{views, true};
+  const auto uncompressed_dictionary = StringDictionary{views};
+  EXPECT_TRUE(dictionary.is_compressed());
+  EXPECT_FALSE(uncompressed_dictionary.is_compressed());
+  EXPECT_EQ(uncompressed_dictionary.symbol_table(), nullptr);
+  EXPECT_EQ(dictionary.size(), values.size());
+  EXPECT_LT(dictionary.estimate_memory_usage(), uncompressed_dictionary.estimate_memory_usage());
+
+  EXPECT_EQ(dictionary.get(0), values[0]);
+  EXPECT_EQ(dictionary.get(199), values[199]);
+  EXPECT_TRUE(dictionary.equals(17, values[17]));
+  EXPECT_FALSE(dictionary.equals(17, values[18]));
+  EXPECT_FALSE(dictionary.equals(17, "https://www.example.com/item/101"));
+
+  EXPECT_EQ(dictionary.lower_bound(values[42]), 42);
+  EXPECT_EQ(dictionary.upper_bound(values[42]), 43);
+  EXPECT_EQ(dictionary.lower_bound("https://www.example.com/item/1042a"), 43);
+  EXPECT_EQ(dictionary.lower_bound("a"), 0);
+  EXPECT_EQ(dictionary.upper_bound("z"), values.size());
+}
+
+TEST_F(StorageFSSTSymbolTableTest, CompressChunk) {
+  auto table = Table{};
+  table.add_column("col_1", "string", true);
+  table.add_column("col_2", "int", false);
+  for (auto index = 0; index < 10; ++index) {
+    table.append({values[index % 3], index});
+  }
+  table.append({NULL_VALUE, 10});
+  table.compress_chunk(ChunkID{0}, EncodingType::FSSTDictionary);
+
+  const auto chunk = table.get_chunk(ChunkID{0});
+  const auto string_segment =
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk->get_segment(ColumnID{0}));
+  ASSERT_TRUE(string_segment);
+  EXPECT_TRUE(string_segment->dictionary().is_compressed());
+  EXPECT_EQ(string_segment->unique_values_count(), 3);
+  EXPECT_EQ(string_segment->get(4), values[1]);
+  EXPECT_EQ(string_segment->get_typed_value(10), std::nullopt);
+  EXPECT_EQ(string_segment->lower_bound(values[2]), ValueID{2});
+
+  const auto int_segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{1}));
+  ASSERT_TRUE(int_segment);
+  EXPECT_EQ(int_segment->get(7), 7);
+}
+
+}  // namespace opossum
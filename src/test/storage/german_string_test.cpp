@@ -0,0 +1,85 @@
+#include "base_test.hpp"
+
+#include "storage/german_string.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageGermanStringTest : public BaseTest {};
+
+TEST_F(StorageGermanStringTest, InlineAndPointerStrings) {
+  const auto short_value = std::string{"ABC-1234"};
+  const auto short_string = GermanString{short_value};
+  EXPECT_TRUE(short_string.is_inline());
+  EXPECT_NE(short_string.data(), short_value.data());
+  EXPECT_EQ(short_string.view(), short_value);
+
+  const auto long_value = std::string{"a string longer than twelve characters"};
+  const auto long_string = GermanString{long_value};
+  EXPECT_FALSE(long_string.is_inline());
+  EXPECT_EQ(long_string.data(), long_value.data());
+  EXPECT_EQ(long_string.size(), long_value.size());
+  EXPECT_EQ(GermanString{}.view(), "");
+  EXPECT_TRUE(GermanString{"123456789012"}.is_inline());
+}
+
+TEST_F(StorageGermanStringTest, Comparisons) {
+  const auto values = std::vector<std::string>{"",     "a",        "a0",           "ab",           "abc",
+                                               "abcd", "abce",     "abcdefghijkl", "abcdefghijklm", "abcdefghijkn",
+                                               "b",    "abcdzzzz", "\xff",         "\xff\xff long string value"};
+  for (const auto& lhs : values) {
+    for (const auto& rhs : values) {
+      const auto lhs_string = GermanString{lhs};
+      const auto rhs_string = GermanString{rhs};
+      EXPECT_EQ(lhs_string == rhs_string, lhs == rhs) << lhs << " == " << rhs;
+      EXPECT_EQ(lhs_string < rhs_string, lhs < rhs) << lhs << " < " << rhs;
+      EXPECT_EQ(lhs_string >= rhs_string, lhs >= rhs) << lhs << " >= " << rhs;
+    }
+  }
+
+  // Equal long strings at different addresses.
+  const auto lhs = std::string{"abcdefghijklmnop"};
+  const auto rhs = std::string{"abcdefghijklmnop"};
+  EXPECT_EQ(GermanString{lhs}, GermanString{rhs});
+  EXPECT_NE(GermanString{lhs}, GermanString{"abcdefghijklmnoq"});
+
+  // Unused payload bytes are zero, but embedded zero bytes still make a difference.
+  const auto zero_terminated = GermanString{std::string_view{"a\0", 2}};
+  EXPECT_LT(GermanString{"a"}, zero_terminated);
+  EXPECT_NE(GermanString{"a"}, zero_terminated);
+}
+
+TEST_F(StorageGermanStringTest, Vector) {
+  auto vector = GermanStringVector{};
+  EXPECT_TRUE(vector.empty());
+  auto expected_values = std::vector<std::string>{};
+  for (auto index = 0; index < 1000; ++index) {
+    expected_values.emplace_back(index % 2 ? std::to_string(index) : std::string(index, 'x'));
+    vector.emplace_back(expected_values.back());
+  }
+  vector.emplace_back();
+  expected_values.emplace_back();
+
+  ASSERT_EQ(vector.size(), expected_values.size());
+  for (auto index = size_t{0}; index < expected_values.size(); ++index) {
+    EXPECT_EQ(vector[index], expected_values[index]);
+    EXPECT_EQ(vector.german_strings()[index], GermanString{expected_values[index]});
+  }
+  EXPECT_GE(vector.estimate_memory_usage(), sizeof(GermanString) * vector.size() + 499 * 500);
+}
+
+TEST_F(StorageGermanStringTest, ValueSegment) {
+  auto segment = ValueSegment<std::string>{true};
+  segment.append("short");
+  segment.append(NULL_VALUE);
+  segment.append("a value that does not fit inline");
+  EXPECT_EQ(segment.get(0), "short");
+  EXPECT_TRUE(variant_is_null(segment[1]));
+  EXPECT_EQ(segment.get(2), "a value that does not fit inline");
+  EXPECT_EQ(segment.values()[2], "a value that does not fit inline");
+  EXPECT_THROW(segment.get(3), std::logic_error);
+  EXPECT_EQ(segment.estimate_memory_usage(),
+            sizeof(GermanString) * segment.values().capacity() + GermanStringVector::MIN_ARENA_BLOCK_SIZE);
+}
+
+}  // namespace opossum
@@ -0,0 +1,105 @@
+#include "base_test.hpp"
+
+#include "storage/null_bitmap.hpp"
+
+namespace opossum {
+
+class StorageNullBitmapTest : public BaseTest {};
+
+TEST_F(StorageNullBitmapTest, PushBackAndSet) {
+  auto bitmap = NullBitmap{};
+  EXPECT_TRUE(bitmap.empty());
+  for (auto index = size_t{0}; index < 130; ++index) {
+    bitmap.push_back(index % 3 == 0);
+  }
+  EXPECT_EQ(bitmap.size(), 130);
+  EXPECT_EQ(bitmap.words().size(), 3);
+  EXPECT_TRUE(bitmap[0]);
+  EXPECT_FALSE(bitmap[1]);
+  EXPECT_TRUE(bitmap[129]);
+  EXPECT_EQ(bitmap.count(), 44);
+
+  bitmap.set(1, true);
+  bitmap.set(129, false);
+  EXPECT_TRUE(bitmap[1]);
+  EXPECT_FALSE(bitmap[129]);
+  EXPECT_EQ(bitmap.count(), 44);
+  EXPECT_EQ(bitmap.estimate_memory_usage(), bitmap.words().capacity() * sizeof(uint64_t));
+}
+
+TEST_F(StorageNullBitmapTest, ResizeKeepsPaddingClear) {
+  auto bitmap = NullBitmap{70, true};
+  EXPECT_EQ(bitmap.count(), 70);
+  EXPECT_EQ(bitmap.words()[1], uint64_t{0b111111});
+
+  bitmap.append(60, false);
+  EXPECT_EQ(bitmap.size(), 130);
+  EXPECT_EQ(bitmap.count(), 70);
+  bitmap.append(2, true);
+  EXPECT_TRUE(bitmap[131]);
+  EXPECT_EQ(bitmap.count(), 72);
+
+  bitmap.resize(65);
+  EXPECT_EQ(bitmap.count(), 65);
+  bitmap.resize(200, false);
+  EXPECT_EQ(bitmap.count(), 65);
+}
+
+TEST_F(StorageNullBitmapTest, FindNextSet) {
+  auto bitmap = NullBitmap{300};
+  EXPECT_EQ(bitmap.find_next_set(0), 300);
+  bitmap.set(5, true);
+  bitmap.set(64, true);
+  bitmap.set(250, true);
+  EXPECT_EQ(bitmap.find_next_set(0), 5);
+  EXPECT_EQ(bitmap.find_next_set(5), 5);
+  EXPECT_EQ(bitmap.find_next_set(6), 64);
+  EXPECT_EQ(bitmap.find_next_set(65), 250);
+  EXPECT_EQ(bitmap.find_next_set(251), 300);
+  EXPECT_EQ(bitmap.find_next_set(1000), 300);
+}
+
+TEST_F(StorageNullBitmapTest, BitwiseOperations) {
+  auto bitmap = NullBitmap{100};
+  auto mask = NullBitmap{100};
+  for (auto index = size_t{0}; index < 100; ++index) {
+    bitmap.set(index, index % 2 == 0);
+    mask.set(index, index < 50);
+  }
+  auto intersection = bitmap;
+  intersection &= mask;
+  EXPECT_EQ(intersection.count(), 25);
+  EXPECT_EQ(intersection.find_next_set(49), 100);
+  EXPECT_FALSE(intersection[50]);
+
+  auto union_bitmap = bitmap;
+  union_bitmap |= mask;
+  EXPECT_EQ(union_bitmap.count(), 75);
+  EXPECT_FALSE(union_bitmap == bitmap);
+  EXPECT_TRUE(bitmap == bitmap);
+  EXPECT_THROW(bitmap &= NullBitmap{99}, std::logic_error);
+}
+
+TEST_F(StorageNullBitmapTest, AppendRange) {
+  auto source = NullBitmap{200};
+  for (auto index = size_t{0}; index < 200; index += 3) {
+    source.set(index, true);
+  }
+  // Covers aligned and unaligned positions in both bitmaps.
+  for (const auto& [initial_size, begin, end] :
+       {std::tuple<size_t, size_t, size_t>{0, 0, 200}, {5, 0, 130}, {64, 7, 71}, {70, 63, 200}}) {
+    auto bitmap = NullBitmap{initial_size, true};
+    bitmap.append(source, begin, end);
+    ASSERT_EQ(bitmap.size(), initial_size + end - begin);
+    auto expected_count = initial_size;
+    for (auto index = size_t{0}; index < bitmap.size(); ++index) {
+      const auto expected = index < initial_size || source[begin + index - initial_size];
+      EXPECT_EQ(bitmap[index], expected) << index;
+      expected_count += index >= initial_size && expected;
+    }
+    // Bits beyond the range are not copied into the padding.
+    EXPECT_EQ(bitmap.count(), expected_count);
+  }
+}
+
+}  // namespace opossum
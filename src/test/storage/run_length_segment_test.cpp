@@ -0,0 +1,86 @@
+#include "base_test.hpp"
+
+#include "storage/run_length_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : {4, 4, 4, 2, 2, 7, 4, 4}) {
+      value_segment_int->append(value);
+    }
+    value_segment_int->append(NULL_VALUE);
+    value_segment_int->append(NULL_VALUE);
+    value_segment_int->append(7);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegment) {
+  const auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(value_segment_int);
+  EXPECT_THROW(std::make_shared<RunLengthSegment<std::string>>(value_segment_int), std::logic_error);
+
+  EXPECT_EQ(rle_segment->size(), 11);
+  EXPECT_EQ(rle_segment->values().size(), 6);
+  EXPECT_EQ(rle_segment->end_positions(), (std::vector<ChunkOffset>{2, 4, 5, 7, 9, 10}));
+  EXPECT_EQ(rle_segment->null_values().size(), 6);
+  EXPECT_EQ(rle_segment->null_values().words(), std::vector<uint64_t>{0b010000});
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment_int->size(); ++chunk_offset) {
+    EXPECT_EQ(rle_segment->get_typed_value(chunk_offset), value_segment_int->get_typed_value(chunk_offset));
+  }
+  EXPECT_EQ((*rle_segment)[3], AllTypeVariant{2});
+  EXPECT_TRUE(variant_is_null((*rle_segment)[9]));
+  EXPECT_THROW(rle_segment->get(8), std::logic_error);
+  EXPECT_THROW(rle_segment->get_typed_value(11), std::logic_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, DefaultValueIsNotMergedWithNullRun) {
+  const auto value_segment = std::make_shared<ValueSegment<std::string>>(true);
+  value_segment->append("");
+  value_segment->append(NULL_VALUE);
+  value_segment->append("");
+
+  const auto rle_segment = RunLengthSegment<std::string>{value_segment};
+  EXPECT_EQ(rle_segment.values().size(), 3);
+  EXPECT_EQ(rle_segment.get_typed_value(0), "");
+  EXPECT_EQ(rle_segment.get_typed_value(1), std::nullopt);
+  EXPECT_EQ(rle_segment.get_typed_value(2), "");
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  const auto rle_segment = RunLengthSegment<int32_t>{std::make_shared<ValueSegment<int32_t>>()};
+  EXPECT_EQ(rle_segment.size(), 0);
+  EXPECT_EQ(rle_segment.estimate_memory_usage(), 0);
+}
+
+TEST_F(StorageRunLengthSegmentTest, Scan) {
+  const auto rle_segment = RunLengthSegment<int32_t>{value_segment_int};
+
+  auto matches = PosList{};
+  rle_segment.scan(ScanType::OpEquals, 4, ChunkID{3}, matches);
+  EXPECT_EQ(matches, (PosList{{ChunkID{3}, 0}, {ChunkID{3}, 1}, {ChunkID{3}, 2}, {ChunkID{3}, 6}, {ChunkID{3}, 7}}));
+
+  // NULL values never match, not even for OpNotEquals.
+  matches.clear();
+  rle_segment.scan(ScanType::OpNotEquals, 4, ChunkID{0}, matches);
+  EXPECT_EQ(matches, (PosList{{ChunkID{0}, 3}, {ChunkID{0}, 4}, {ChunkID{0}, 5}, {ChunkID{0}, 10}}));
+
+  matches.clear();
+  rle_segment.scan(ScanType::OpGreaterThanEquals, 7, ChunkID{0}, matches);
+  EXPECT_EQ(matches, (PosList{{ChunkID{0}, 5}, {ChunkID{0}, 10}}));
+
+  matches.clear();
+  rle_segment.scan(ScanType::OpLessThan, 2, ChunkID{0}, matches);
+  EXPECT_TRUE(matches.empty());
+}
+
+TEST_F(StorageRunLengthSegmentTest, MemoryUsage) {
+  const auto rle_segment = RunLengthSegment<int32_t>{value_segment_int};
+  // Six runs, each with a value, an end position, and a NULL flag. The NULL flags are packed into a single word.
+  EXPECT_EQ(rle_segment.estimate_memory_usage(), 6 * sizeof(int32_t) + 6 * sizeof(ChunkOffset) + sizeof(uint64_t));
+}
+
+}  // namespace opossum
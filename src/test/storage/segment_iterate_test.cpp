@@ -0,0 +1,112 @@
+#include "base_test.hpp"
+
+#include "storage/segment_iterate.hpp"
+
+namespace opossum {
+
+class StorageSegmentIterateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Enough rows that bit-packed value ids are decoded in more than one block.
+    auto int_values = std::vector<int32_t>{};
+    auto string_values = std::vector<std::string>{};
+    auto null_values = NullBitmap{};
+    for (auto index = int32_t{0}; index < 5'000; ++index) {
+      int_values.emplace_back(index % 37 - 10);
+      string_values.emplace_back("a somewhat longer string " + std::to_string(index % 23));
+      null_values.push_back(index % 11 == 0);
+    }
+    int_segment = std::make_shared<ValueSegment<int32_t>>(std::move(int_values), NullBitmap{null_values});
+    string_segment = std::make_shared<ValueSegment<std::string>>(std::move(string_values), std::move(null_values));
+  }
+
+  // Checks that segment_iterate yields every row in order, with the values of AbstractSegment::operator[].
+  template <typename T>
+  void expect_iterates_like_variants(const AbstractSegment& segment) {
+    auto expected_offset = ChunkOffset{0};
+    segment_iterate<T>(segment, [&](const auto& position) {
+      ASSERT_EQ(position.chunk_offset(), expected_offset);
+      const auto expected_value = segment[expected_offset];
+      EXPECT_EQ(position.is_null(), variant_is_null(expected_value));
+      if (!position.is_null()) {
+        EXPECT_EQ(T{position.value()}, boost::get<T>(expected_value));
+      }
+      ++expected_offset;
+    });
+    EXPECT_EQ(expected_offset, segment.size());
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> int_segment;
+  std::shared_ptr<ValueSegment<std::string>> string_segment;
+};
+
+TEST_F(StorageSegmentIterateTest, ValueSegments) {
+  expect_iterates_like_variants<int32_t>(*int_segment);
+  expect_iterates_like_variants<std::string>(*string_segment);
+
+  // Strings are handed out as views into the segment.
+  segment_iterate<std::string>(*string_segment, [](const auto& position) {
+    EXPECT_TRUE((std::is_same_v<std::decay_t<decltype(position.value())>, std::string_view>));
+  });
+}
+
+TEST_F(StorageSegmentIterateTest, EncodedSegments) {
+  expect_iterates_like_variants<int32_t>(DictionarySegment<int32_t>{int_segment});
+  expect_iterates_like_variants<int32_t>(DictionarySegment<int32_t>{int_segment, VectorCompressionType::BitPacked});
+  expect_iterates_like_variants<std::string>(DictionarySegment<std::string>{string_segment});
+  expect_iterates_like_variants<std::string>(
+      DictionarySegment<std::string>{string_segment, VectorCompressionType::BitPacked, true});
+  expect_iterates_like_variants<int32_t>(RunLengthSegment<int32_t>{int_segment});
+  expect_iterates_like_variants<std::string>(RunLengthSegment<std::string>{string_segment});
+  expect_iterates_like_variants<int32_t>(FrameOfReferenceSegment<int32_t>{int_segment});
+
+  const auto& values = int_segment->values();
+  expect_iterates_like_variants<int32_t>(
+      ExternalSegment<int32_t>{std::span<const int32_t>{values}, int_segment, NullBitmap{int_segment->null_values()}});
+}
+
+TEST_F(StorageSegmentIterateTest, ReferenceSegments) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int", true);
+  for (auto value = int32_t{0}; value < 8; ++value) {
+    table->append({value == 4 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value * 10}});
+  }
+  table->compress_chunk(ChunkID{1});
+  table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+
+  const auto pos_list = std::make_shared<PosList>(PosList{
+      RowID{ChunkID{2}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 0}, NULL_ROW_ID, NULL_ROW_ID, RowID{ChunkID{1}, 1},
+      RowID{ChunkID{1}, 0}, RowID{ChunkID{2}, 0}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  expect_iterates_like_variants<int32_t>(reference_segment);
+}
+
+TEST_F(StorageSegmentIterateTest, FilteredPositions) {
+  const auto dictionary_segment = DictionarySegment<int32_t>{int_segment, VectorCompressionType::BitPacked};
+  const auto positions = PosList{RowID{ChunkID{0}, 4'000}, RowID{ChunkID{0}, 11}, RowID{ChunkID{0}, 3}};
+
+  auto values = std::vector<std::optional<int32_t>>{};
+  segment_iterate_filtered<int32_t>(dictionary_segment, positions, [&](const auto& position) {
+    EXPECT_EQ(position.chunk_offset(), values.size());
+    values.emplace_back(position.is_null() ? std::nullopt : std::optional<int32_t>{position.value()});
+  });
+  EXPECT_EQ(values, (std::vector<std::optional<int32_t>>{4'000 % 37 - 10, std::nullopt, -7}));
+
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int", true);
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, std::make_shared<PosList>()};
+  EXPECT_THROW(segment_iterate_filtered<int32_t>(reference_segment, positions, [](const auto&) {}), std::logic_error);
+}
+
+TEST_F(StorageSegmentIterateTest, ResolveSegmentType) {
+  auto resolved_value_segment = false;
+  resolve_segment_type<int32_t>(*int_segment, [&](const auto& typed_segment) {
+    resolved_value_segment = std::is_same_v<std::decay_t<decltype(typed_segment)>, ValueSegment<int32_t>>;
+  });
+  EXPECT_TRUE(resolved_value_segment);
+
+  // The data type has to match the segment.
+  EXPECT_THROW(resolve_segment_type<float>(*int_segment, [](const auto&) {}), std::logic_error);
+}
+
+}  // namespace opossum
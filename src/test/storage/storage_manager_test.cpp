@@ -1,3 +1,6 @@
+#include <filesystem>
+#include <fstream>
+
 #include "base_test.hpp"
 
 #include "storage/storage_manager.hpp"
@@ -57,4 +60,75 @@ TEST_F(StorageStorageManagerTest, GetTableNames) {
   EXPECT_NE(std::find(table_names.begin(), table_names.end(), "second_table"), table_names.end());
 }
 
+TEST_F(StorageStorageManagerTest, SaveAndLoad) {
+  auto& storage_manager = StorageManager::get();
+  const auto table = storage_manager.get_table("second_table");
+  table->add_column("a", "int", false);
+  table->add_column("b", "string", true);
+  for (auto index = 0; index < 10; ++index) {
+    table->append({index, index % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{std::to_string(index)}});
+  }
+  table->compress_chunk(ChunkID{0});
+
+  const auto directory = std::filesystem::temp_directory_path() / "opossum_storage_manager_test";
+  std::filesystem::remove_all(directory);
+  storage_manager.save(directory.string());
+  EXPECT_THROW(storage_manager.load(directory.string()), std::logic_error);
+
+  for (const auto map_files : {false, true}) {
+    storage_manager.reset();
+    storage_manager.load(directory.string(), map_files);
+    EXPECT_EQ(storage_manager.table_names().size(), 2);
+    EXPECT_EQ(storage_manager.get_table("first_table")->row_count(), 0);
+    const auto loaded_table = storage_manager.get_table("second_table");
+    EXPECT_EQ(loaded_table->row_count(), 10);
+    EXPECT_EQ(loaded_table->chunk_count(), table->chunk_count());
+    EXPECT_EQ((*loaded_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[2], AllTypeVariant{2});
+    EXPECT_EQ((*loaded_table->get_chunk(ChunkID{2})->get_segment(ColumnID{1}))[0], AllTypeVariant{"8"});
+  }
+
+  // Directories without a valid manifest are rejected.
+  storage_manager.reset();
+  std::ofstream{directory / "manifest"} << "something else\n";
+  EXPECT_THROW(storage_manager.load(directory.string()), std::logic_error);
+  std::filesystem::remove_all(directory);
+  EXPECT_THROW(storage_manager.load(directory.string()), std::logic_error);
+}
+
+TEST_F(StorageStorageManagerTest, SaveOverExistingSave) {
+  auto& storage_manager = StorageManager::get();
+  const auto directory = std::filesystem::temp_directory_path() / "opossum_storage_manager_overwrite_test";
+  std::filesystem::remove_all(directory);
+  storage_manager.save(directory.string());
+
+  // The second save has fewer tables, so the file of the second table of the first save is not overwritten.
+  storage_manager.drop_table("first_table");
+  const auto table = storage_manager.get_table("second_table");
+  table->add_column("a", "int", false);
+  table->append({17});
+  storage_manager.save(directory.string());
+  EXPECT_FALSE(std::filesystem::exists(directory / "manifest.tmp"));
+
+  storage_manager.reset();
+  storage_manager.load(directory.string());
+  EXPECT_EQ(storage_manager.table_names(), std::vector<std::string>{"second_table"});
+  EXPECT_EQ((*storage_manager.get_table("second_table")->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[0],
+            AllTypeVariant{17});
+  std::filesystem::remove_all(directory);
+}
+
+TEST_F(StorageStorageManagerTest, LoadRejectsDuplicateNames) {
+  auto& storage_manager = StorageManager::get();
+  const auto directory = std::filesystem::temp_directory_path() / "opossum_storage_manager_duplicate_test";
+  std::filesystem::remove_all(directory);
+  storage_manager.save(directory.string());
+  std::ofstream{directory / "manifest"} << "opossum-catalog 1\ntable_0.bin t\ntable_1.bin u\ntable_0.bin t\n";
+
+  // No table is added if the manifest lists a name twice.
+  storage_manager.reset();
+  EXPECT_THROW(storage_manager.load(directory.string()), std::logic_error);
+  EXPECT_TRUE(storage_manager.table_names().empty());
+  std::filesystem::remove_all(directory);
+}
+
 }  // namespace opossum
@@ -0,0 +1,54 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/string_dictionary.hpp"
+
+namespace opossum {
+
+class StorageStringDictionaryTest : public BaseTest {
+ protected:
+  StringDictionary dictionary{{"", "Alexander", "Bill", "Hasso", "Steve"}};
+};
+
+TEST_F(StorageStringDictionaryTest, Access) {
+  EXPECT_EQ(dictionary.size(), 5);
+  EXPECT_EQ(dictionary.capacity(), 5);
+  EXPECT_FALSE(dictionary.empty());
+  EXPECT_EQ(dictionary[0], "");
+  EXPECT_EQ(dictionary[1], "Alexander");
+  EXPECT_EQ(dictionary[4], "Steve");
+
+  EXPECT_EQ(dictionary.characters().size(), 23);
+  EXPECT_EQ(dictionary.offsets(), (Buffer<uint32_t>{std::vector<uint32_t>{0, 0, 9, 13, 18, 23}}));
+
+  const auto empty_dictionary = StringDictionary{};
+  EXPECT_EQ(empty_dictionary.size(), 0);
+  EXPECT_TRUE(empty_dictionary.empty());
+  EXPECT_EQ(empty_dictionary.lower_bound("a"), 0);
+}
+
+TEST_F(StorageStringDictionaryTest, Bounds) {
+  EXPECT_EQ(dictionary.lower_bound(""), 0);
+  EXPECT_EQ(dictionary.upper_bound(""), 1);
+  EXPECT_EQ(dictionary.lower_bound("Bill"), 2);
+  EXPECT_EQ(dictionary.upper_bound("Bill"), 3);
+  EXPECT_EQ(dictionary.lower_bound("Bob"), 3);
+  EXPECT_EQ(dictionary.upper_bound("Bob"), 3);
+  EXPECT_EQ(dictionary.lower_bound("Zed"), 5);
+  EXPECT_EQ(dictionary.upper_bound("Steve"), 5);
+}
+
+TEST_F(StorageStringDictionaryTest, MemoryUsageOfDictionarySegment) {
+  const auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  value_segment->append("Hasso");
+  value_segment->append("Bill");
+  value_segment->append("Hasso");
+  value_segment->append("a rather long string that does not fit into the small string buffer");
+
+  const auto dict_segment = DictionarySegment<std::string>{value_segment};
+  EXPECT_EQ(dict_segment.dictionary()[2], "a rather long string that does not fit into the small string buffer");
+  // Characters of all three distinct values, four offsets, and one byte per value id.
+  EXPECT_EQ(dict_segment.estimate_memory_usage(), (5 + 4 + 67) + 4 * sizeof(uint32_t) + 4 * sizeof(uint8_t));
+}
+
+}  // namespace opossum
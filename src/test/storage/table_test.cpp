@@ -1,5 +1,9 @@
 #include "base_test.hpp"
 
+#include "storage/column_values.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -111,6 +115,181 @@ TEST_F(StorageTableTest, AppendWithEncodedSegments) {
   EXPECT_EQ(table.chunk_count(), 2);
 }
 
+TEST_F(StorageTableTest, CompressWithRunLengthEncoding) {
+  table.append({4, "Hello,"});
+  table.append({4, NULL_VALUE});
+  table.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+
+  const auto chunk = table.get_chunk(ChunkID{0});
+  const auto int_segment = std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(chunk->get_segment(ColumnID{0}));
+  ASSERT_TRUE(int_segment);
+  EXPECT_EQ(int_segment->values().size(), 1);
+  const auto string_segment =
+      std::dynamic_pointer_cast<RunLengthSegment<std::string>>(chunk->get_segment(ColumnID{1}));
+  ASSERT_TRUE(string_segment);
+  EXPECT_EQ(string_segment->get_typed_value(0), "Hello,");
+  EXPECT_EQ(string_segment->get_typed_value(1), std::nullopt);
+}
+
+TEST_F(StorageTableTest, CompressWithFrameOfReferenceEncoding) {
+  table.append({4, "Hello,"});
+  EXPECT_THROW(table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference), std::logic_error);
+
+  auto int_table = Table{2};
+  int_table.add_column("col_1", "int", false);
+  int_table.add_column("col_2", "long", true);
+  int_table.append({4, int64_t{100}});
+  int_table.append({6, NULL_VALUE});
+  int_table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+
+  const auto chunk = int_table.get_chunk(ChunkID{0});
+  const auto int_segment =
+      std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(chunk->get_segment(ColumnID{0}));
+  ASSERT_TRUE(int_segment);
+  EXPECT_EQ(int_segment->get(1), 6);
+  const auto long_segment =
+      std::dynamic_pointer_cast<FrameOfReferenceSegment<int64_t>>(chunk->get_segment(ColumnID{1}));
+  ASSERT_TRUE(long_segment);
+  EXPECT_EQ(long_segment->get_typed_value(0), 100);
+  EXPECT_EQ(long_segment->get_typed_value(1), std::nullopt);
+
+  // Values that span more than 32 bits are encoded as well.
+  auto wide_table = Table{4};
+  wide_table.add_column("col_1", "long", false);
+  for (const auto value : {int64_t{0}, int64_t{1} << 40, int64_t{5}, int64_t{7}}) {
+    wide_table.append({value});
+  }
+  wide_table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  const auto wide_segment = wide_table.get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_EQ((*wide_segment)[1], AllTypeVariant{int64_t{1} << 40});
+  EXPECT_EQ((*wide_segment)[3], AllTypeVariant{int64_t{7}});
+}
+
+TEST_F(StorageTableTest, CreateCompressedChunk) {
+  table.append({4, "Hello,"});
+  table.append({6, NULL_VALUE});
+  const auto chunk = table.get_chunk(ChunkID{0});
+  const auto compressed_chunk = table.create_compressed_chunk(chunk);
+
+  // The table itself is not changed.
+  EXPECT_EQ(table.get_chunk(ChunkID{0}), chunk);
+  EXPECT_EQ(table.chunk_count(), 1);
+  const auto string_segment =
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(compressed_chunk->get_segment(ColumnID{1}));
+  ASSERT_TRUE(string_segment);
+  EXPECT_EQ(string_segment->get_typed_value(0), "Hello,");
+  EXPECT_EQ(string_segment->get_typed_value(1), std::nullopt);
+  EXPECT_TRUE(compressed_chunk->get_segment_statistics(ColumnID{0}));
+
+  EXPECT_THROW(table.create_compressed_chunk(chunk, EncodingType::FrameOfReference), std::logic_error);
+  EXPECT_THROW(table.create_compressed_chunk(std::make_shared<Chunk>()), std::logic_error);
+}
+
+TEST_F(StorageTableTest, CompressChunkAsync) {
+  table.append({4, "Hello,"});
+  table.append({6, NULL_VALUE});
+  auto compressed_chunk = table.compress_chunk_async(ChunkID{0});
+  // The new chunk for appends is created right away.
+  EXPECT_EQ(table.chunk_count(), 2);
+  // The jobs do not touch the table, the caller swaps in the compressed chunk.
+  const auto new_chunk = compressed_chunk.get();
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<std::string>>(
+      table.get_chunk(ChunkID{0})->get_segment(ColumnID{1})));
+  table.replace_chunk(ChunkID{0}, new_chunk);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      table.get_chunk(ChunkID{0})->get_segment(ColumnID{1})));
+  EXPECT_THROW(table.replace_chunk(ChunkID{1}, new_chunk), std::logic_error);
+
+  // Exceptions of the encoders are passed on through the future.
+  auto failed_compression = table.compress_chunk_async(ChunkID{0});
+  EXPECT_THROW(failed_compression.get(), std::logic_error);
+  EXPECT_THROW(table.compress_chunk(ChunkID{0}), std::logic_error);
+}
+
+TEST_F(StorageTableTest, CompressAllChunks) {
+  for (auto index = 0; index < 7; ++index) {
+    table.append({index, std::to_string(index)});
+  }
+  table.compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  table.compress_all_chunks();
+
+  // The last chunk is compressed as well, so a new chunk is created for appends.
+  EXPECT_EQ(table.chunk_count(), 5);
+  EXPECT_EQ(table.row_count(), 7);
+  EXPECT_EQ(table.get_chunk(ChunkID{4})->size(), 0);
+  for (const auto chunk_id : {ChunkID{0}, ChunkID{2}, ChunkID{3}}) {
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+        table.get_chunk(chunk_id)->get_segment(ColumnID{0})));
+  }
+  // Encoded chunks are skipped.
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(table.get_chunk(ChunkID{1})->get_segment(ColumnID{0})));
+  EXPECT_EQ((*table.get_chunk(ChunkID{3})->get_segment(ColumnID{1}))[0], AllTypeVariant{"6"});
+}
+
+TEST_F(StorageTableTest, CompressAllChunksWhileFillingLastChunk) {
+  auto large_table = Table{1'000};
+  large_table.add_column("a", "int", false);
+  large_table.add_column("b", "string", true);
+  for (auto index = 0; index < 8'500; ++index) {
+    large_table.append({index, index % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{std::to_string(index)}});
+  }
+  // The last chunk is only half full. It is compressed as well, and the appends afterwards go into a new chunk. Under
+  // TSan, this checks that the compression jobs do not access the chunks of the table while the caller changes them.
+  large_table.compress_all_chunks();
+  EXPECT_EQ(large_table.chunk_count(), 10);
+  for (auto index = 8'500; index < 9'000; ++index) {
+    large_table.append({index, std::to_string(index)});
+  }
+  EXPECT_EQ(large_table.chunk_count(), 10);
+  EXPECT_EQ(large_table.row_count(), 9'000);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 9; ++chunk_id) {
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+        large_table.get_chunk(chunk_id)->get_segment(ColumnID{1})));
+  }
+  EXPECT_EQ((*large_table.get_chunk(ChunkID{8})->get_segment(ColumnID{1}))[498], AllTypeVariant{"8498"});
+  EXPECT_EQ((*large_table.get_chunk(ChunkID{9})->get_segment(ColumnID{0}))[0], AllTypeVariant{8'500});
+}
+
+TEST_F(StorageTableTest, AppendColumns) {
+  table.append({1, "first"});
+  auto nulls = NullBitmap{4};
+  nulls.set(2, true);
+  const auto int_values = std::make_shared<ColumnValues<int32_t>>(std::vector<int32_t>{2, 3, 4, 5});
+  const auto string_values = std::make_shared<ColumnValues<std::string>>(
+      std::vector<std::string>{"second", "third", "", "a string that is not stored inline"}, std::move(nulls));
+  table.append_columns({int_values, string_values});
+
+  // The first chunk is filled up before new chunks are created.
+  EXPECT_EQ(table.row_count(), 5);
+  EXPECT_EQ(table.chunk_count(), 3);
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->size(), 2);
+  const auto string_segment =
+      std::dynamic_pointer_cast<ValueSegment<std::string>>(table.get_chunk(ChunkID{1})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(string_segment);
+  EXPECT_EQ(string_segment->get_typed_value(0), "third");
+  EXPECT_EQ(string_segment->get_typed_value(1), std::nullopt);
+  EXPECT_EQ((*table.get_chunk(ChunkID{2})->get_segment(ColumnID{0}))[0], AllTypeVariant{5});
+  EXPECT_EQ((*table.get_chunk(ChunkID{2})->get_segment(ColumnID{1}))[0],
+            AllTypeVariant{"a string that is not stored inline"});
+}
+
+TEST_F(StorageTableTest, AppendColumnsValidatesInput) {
+  const auto int_values = std::make_shared<ColumnValues<int32_t>>(std::vector<int32_t>{1, 2});
+  const auto long_values = std::make_shared<ColumnValues<int64_t>>(std::vector<int64_t>{1, 2});
+  const auto string_values = std::make_shared<ColumnValues<std::string>>(std::vector<std::string>{"a", "b"});
+  const auto short_values = std::make_shared<ColumnValues<std::string>>(std::vector<std::string>{"a"});
+  const auto null_values =
+      std::make_shared<ColumnValues<int32_t>>(std::vector<int32_t>{1, 2}, NullBitmap{2, true});
+
+  EXPECT_THROW(table.append_columns({int_values}), std::logic_error);
+  EXPECT_THROW(table.append_columns({long_values, string_values}), std::logic_error);
+  EXPECT_THROW(table.append_columns({int_values, short_values}), std::logic_error);
+  EXPECT_THROW(table.append_columns({null_values, string_values}), std::logic_error);
+  EXPECT_THROW(ColumnValues<int32_t>(std::vector<int32_t>{1}, NullBitmap{2}), std::logic_error);
+  EXPECT_EQ(table.row_count(), 0);
+}
+
 TEST_F(StorageTableTest, AppendsDuringCompressionAreNotLost) {
   // Create a table with a lot of values in a single chunk
   // Below number is enough that compression finishes after >> 50ms, which means this test should not pass
@@ -88,4 +88,18 @@ TEST_F(StorageValueSegmentTest, TestNullable) {
   EXPECT_FALSE(not_nullable_segment.is_null(0));
 }
 
+TEST_F(StorageValueSegmentTest, AdoptValues) {
+  auto values = std::vector<int32_t>{4, 5, 6};
+  const auto* data = values.data();
+  const auto adopted_segment = ValueSegment<int32_t>{std::move(values), NullBitmap{3}};
+  EXPECT_EQ(adopted_segment.values().data(), data);
+  EXPECT_TRUE(adopted_segment.is_nullable());
+  EXPECT_EQ(adopted_segment.get(2), 6);
+
+  const auto string_segment = ValueSegment<std::string>{std::vector<std::string>{"a", "b"}};
+  EXPECT_FALSE(string_segment.is_nullable());
+  EXPECT_EQ(string_segment.get(1), "b");
+  EXPECT_THROW(ValueSegment<int32_t>(std::vector<int32_t>{1}, NullBitmap{2}), std::logic_error);
+}
+
 }  // namespace opossum